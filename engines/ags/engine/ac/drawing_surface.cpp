@@ -29,6 +29,7 @@
 #include "ags/engine/ac/global_translation.h"
 #include "ags/engine/ac/room_object.h"
 #include "ags/engine/ac/room_status.h"
+#include "ags/engine/ac/route_finder_regions.h"
 #include "ags/engine/ac/string.h"
 #include "ags/engine/ac/walk_behind.h"
 #include "ags/engine/ac/dynobj/dynobj_manager.h"
@@ -66,6 +67,8 @@ void DrawingSurface_Release(ScriptDrawingSurface *sds) {
 	if (sds->roomMaskType > kRoomAreaNone) {
 		if (sds->roomMaskType == kRoomAreaWalkBehind) {
 			walkbehinds_recalc();
+		} else if (sds->roomMaskType == kRoomAreaWalkable) {
+			_GP(walkable_regions).Invalidate();
 		}
 		sds->roomMaskType = kRoomAreaNone;
 	}
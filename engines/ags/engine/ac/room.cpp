@@ -65,6 +65,7 @@
 #include "ags/engine/script/script.h"
 #include "ags/engine/script/script_runtime.h"
 #include "ags/shared/ac/sprite_cache.h"
+#include "ags/shared/ac/view.h"
 #include "ags/shared/util/stream.h"
 #include "ags/engine/gfx/graphics_driver.h"
 #include "ags/shared/core/asset_manager.h"
@@ -414,6 +415,35 @@ static void reset_temp_room() {
 	_GP(troom) = RoomStatus();
 }
 
+static void prefetch_view_loop(int view, int loop) {
+	if (view < 0 || view >= _GP(game).numviews)
+		return;
+	const ViewStruct &vs = _GP(views)[view];
+	if (loop < 0 || loop >= vs.numLoops)
+		return;
+	for (int i = 0; i < vs.loops[loop].numFrames; ++i)
+		_GP(spriteset).PrefetchSprite(vs.loops[loop].frames[i].pic);
+}
+
+// Loads sprites that the room's objects and characters are going to display
+// first, so that their animations don't stall on reading the sprite file;
+// this only fills the free space in the sprite cache
+static void prefetch_room_sprites() {
+	for (uint32_t i = 0; i < _G(croom)->numobj; ++i) {
+		const RoomObject &obj = _G(objs)[i];
+		if (!obj.on)
+			continue;
+		_GP(spriteset).PrefetchSprite(obj.num);
+		if (obj.view != RoomObject::NoView)
+			prefetch_view_loop(obj.view, obj.loop);
+	}
+	for (int i = 0; i < _GP(game).numcharacters; ++i) {
+		const CharacterInfo &chi = _GP(game).chars[i];
+		if (chi.room == _G(displayed_room) && chi.on)
+			prefetch_view_loop(chi.view, chi.loop);
+	}
+}
+
 // forchar = playerchar on NewRoom, or NULL if restore saved game
 void load_new_room(int newnum, CharacterInfo *forchar) {
 
@@ -845,6 +875,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		_GP(play).UpdateRoomCameras(); // update auto tracking
 	}
 	init_room_drawdata();
+	prefetch_room_sprites();
 
 	set_our_eip(212);
 	invalidate_screen();
@@ -32,6 +32,8 @@
 #include "ags/shared/gfx/bitmap.h"
 #include "ags/shared/debugging/out.h"
 #include "ags/engine/ac/route_finder_jps.h"
+#include "ags/engine/ac/route_finder_regions.h"
+#include "ags/shared/game/room_struct.h"
 #include "ags/globals.h"
 
 namespace AGS3 {
@@ -105,6 +107,29 @@ static int find_route_jps(int fromx, int fromy, int destx, int desty) {
 	return 1;
 }
 
+// Moves the target to the closest point of the start's walkable region,
+// if it lies outside of it. Returns false if there is no closer point
+static bool clamp_target_to_start_region(int srcx, int srcy, int &destx, int &desty) {
+	const Bitmap *mask = _GP(thisroom).WalkAreaMask.get();
+	if (!mask || (mask->GetWidth() != _G(wallscreen)->GetWidth()) ||
+		(mask->GetHeight() != _G(wallscreen)->GetHeight()))
+		return true;
+
+	if (!_GP(walkable_regions).IsValid() || !_GP(walkable_regions).HasSize(mask->GetWidth(), mask->GetHeight()))
+		_GP(walkable_regions).Build(mask);
+
+	const int region = _GP(walkable_regions).GetRegion(srcx, srcy);
+	if ((region == 0) || (_GP(walkable_regions).GetRegion(destx, desty) == region))
+		return true;
+
+	int x, y;
+	if (!_GP(walkable_regions).FindClosestPoint(region, destx, desty, x, y) || ((x == srcx) && (y == srcy)))
+		return false;
+	destx = x;
+	desty = y;
+	return true;
+}
+
 inline fixed input_speed_to_fixed(int speed_val) {
 	// negative move speeds like -2 get converted to 1/2
 	if (speed_val < 0) {
@@ -254,7 +279,12 @@ int find_route(short srcx, short srcy, short xx, short yy, int move_speed_x, int
 		if ((nocross == 0) && (_G(wallscreen)->GetPixel(xx, yy) == 0))
 			return 0; // clicked on a wall
 
-		find_route_jps(srcx, srcy, xx, yy);
+		// The JPS search would go through the whole walkable region of the
+		// start to find the point closest to an unreachable target; the
+		// region labels of the room tell that point directly
+		int destx = xx, desty = yy;
+		if (clamp_target_to_start_region(srcx, srcy, destx, desty))
+			find_route_jps(srcx, srcy, destx, desty);
 	}
 
 	if (!_G(num_navpoints))
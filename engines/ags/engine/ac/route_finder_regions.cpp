@@ -0,0 +1,135 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ags/engine/ac/route_finder_regions.h"
+#include "ags/shared/gfx/bitmap.h"
+
+namespace AGS3 {
+
+using AGS::Shared::Bitmap;
+
+// labels are 16-bit, masks with more regions are left unlabelled
+static const int MAX_REGIONS = 0xFFFF;
+
+WalkableRegions::WalkableRegions()
+	: _width(0)
+	, _height(0)
+	, _valid(false) {
+}
+
+void WalkableRegions::Build(const Bitmap *mask) {
+	_width = mask->GetWidth();
+	_height = mask->GetHeight();
+	_valid = true;
+	_labels.clear();
+	_labels.resize(_width * _height, 0);
+	_bounds.clear();
+	_bounds.push_back(Rect()); // label 0 is not walkable
+
+	for (int y = 0; y < _height; y++) {
+		const unsigned char *row = mask->GetScanLine(y);
+		for (int x = 0; x < _width; x++) {
+			if ((row[x] == 0) || (_labels[y * _width + x] != 0))
+				continue;
+
+			if ((int)_bounds.size() > MAX_REGIONS) {
+				_labels.clear();
+				_bounds.clear();
+				return;
+			}
+
+			// Flood the region with a new label. Only orthogonal neighbours
+			// are connected: the route finder does not step diagonally past
+			// a corner, so this matches what it can reach
+			const uint16_t label = (uint16_t)_bounds.size();
+			Rect bounds(x, y, x, y);
+			_stack.clear();
+			_stack.push_back(y * _width + x);
+			_labels[y * _width + x] = label;
+			while (!_stack.empty()) {
+				const int index = _stack.back();
+				_stack.pop_back();
+				const int px = index % _width;
+				const int py = index / _width;
+				bounds.Left = MIN(bounds.Left, px);
+				bounds.Right = MAX(bounds.Right, px);
+				bounds.Top = MIN(bounds.Top, py);
+				bounds.Bottom = MAX(bounds.Bottom, py);
+
+				if ((px > 0) && (_labels[index - 1] == 0) && (mask->GetScanLine(py)[px - 1] != 0)) {
+					_labels[index - 1] = label;
+					_stack.push_back(index - 1);
+				}
+				if ((px < _width - 1) && (_labels[index + 1] == 0) && (mask->GetScanLine(py)[px + 1] != 0)) {
+					_labels[index + 1] = label;
+					_stack.push_back(index + 1);
+				}
+				if ((py > 0) && (_labels[index - _width] == 0) && (mask->GetScanLine(py - 1)[px] != 0)) {
+					_labels[index - _width] = label;
+					_stack.push_back(index - _width);
+				}
+				if ((py < _height - 1) && (_labels[index + _width] == 0) && (mask->GetScanLine(py + 1)[px] != 0)) {
+					_labels[index + _width] = label;
+					_stack.push_back(index + _width);
+				}
+			}
+			_bounds.push_back(bounds);
+		}
+	}
+}
+
+int WalkableRegions::GetRegion(int x, int y) const {
+	if (_labels.empty() || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+		return 0;
+	return _labels[y * _width + x];
+}
+
+bool WalkableRegions::FindClosestPoint(int region, int x, int y, int &cx, int &cy) const {
+	if ((region <= 0) || (region >= (int)_bounds.size()))
+		return false;
+
+	const Rect &bounds = _bounds[region];
+	int64_t best = -1;
+	for (int py = bounds.Top; py <= bounds.Bottom; py++) {
+		const int64_t dy = py - y;
+		if ((best >= 0) && (dy * dy >= best)) {
+			if (py > y)
+				break;
+			continue;
+		}
+
+		const uint16_t *row = &_labels[py * _width];
+		for (int px = bounds.Left; px <= bounds.Right; px++) {
+			if (row[px] != region)
+				continue;
+			const int64_t dx = px - x;
+			const int64_t dist = dx * dx + dy * dy;
+			if ((best < 0) || (dist < best)) {
+				best = dist;
+				cx = px;
+				cy = py;
+			}
+		}
+	}
+	return best >= 0;
+}
+
+} // namespace AGS3
@@ -0,0 +1,85 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//=============================================================================
+//
+// Connected regions of the room's walkable areas, for the route finder.
+//
+// Characters and solid objects are only ever cut out of the walkable areas
+// when a route is searched, so two points in different regions can never be
+// connected by a route, whatever is standing in the way.
+//
+//=============================================================================
+
+#ifndef AGS_ENGINE_AC_ROUTE_FINDER_REGIONS_H
+#define AGS_ENGINE_AC_ROUTE_FINDER_REGIONS_H
+
+#include "common/std/vector.h"
+#include "ags/shared/util/geometry.h"
+
+namespace AGS3 {
+
+// Forward declaration
+namespace AGS {
+namespace Shared {
+class Bitmap;
+} // namespace Shared
+} // namespace AGS
+
+class WalkableRegions {
+public:
+	WalkableRegions();
+
+	// Labels the connected walkable parts of the given mask
+	void Build(const AGS::Shared::Bitmap *mask);
+	// Marks the labels as outdated, they are rebuilt on next use
+	void Invalidate() {
+		_valid = false;
+	}
+	bool IsValid() const {
+		return _valid;
+	}
+	bool HasSize(int width, int height) const {
+		return (_width == width) && (_height == height);
+	}
+
+	// Returns the region at the given position, or 0 if it is not walkable
+	// or the regions are not known
+	int GetRegion(int x, int y) const;
+	// Finds the point of the region which is closest to the given position;
+	// returns false if there is no such region
+	bool FindClosestPoint(int region, int x, int y, int &cx, int &cy) const;
+
+private:
+	int _width;
+	int _height;
+	bool _valid;
+	// region label of each mask pixel, 0 = not walkable
+	std::vector<uint16_t> _labels;
+	// bounding rectangle of each region, indexed by label
+	std::vector<Rect> _bounds;
+	// temporary buffer for the flood fill
+	std::vector<int> _stack;
+};
+
+} // namespace AGS3
+
+#endif
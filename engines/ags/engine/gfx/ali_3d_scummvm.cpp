@@ -477,6 +477,12 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 		int drawAtX = sprite.x + surf_offx;
 		int drawAtY = sprite.y + surf_offy;
 
+		// Skip sprites lying completely outside of the surface, before
+		// setting up any blender for them
+		if ((drawAtX >= surface->GetWidth()) || (drawAtY >= surface->GetHeight()) ||
+			(drawAtX + bitmap->_bmp->GetWidth() <= 0) || (drawAtY + bitmap->_bmp->GetHeight() <= 0))
+			continue;
+
 		if (bitmap->_alpha == 0) {
 		} // fully transparent, do nothing
 		else if ((bitmap->_opaque) && (bitmap->_bmp == surface) && (bitmap->_alpha == 255)) {
@@ -501,31 +507,42 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 	return from;
 }
 
+// Converts one row of ARGB pixels to the screen's byte order; returns the
+// range of pixels that actually changed in first_x..last_x, or -1 if none
+template<bool ToRGBA>
+static void convertARGBRow(const uint32 *srcP, uint32 *destP, int w, int &first_x, int &last_x) {
+	first_x = last_x = -1;
+	for (int x = 0; x < w; ++x) {
+		const uint32 pixel = ToRGBA ?
+			(((srcP[x] & 0xffffff) << 8) | ((srcP[x] >> 24) & 0xff)) :
+			((srcP[x] & 0xff00ff00) | ((srcP[x] & 0xff) << 16) | ((srcP[x] >> 16) & 0xff));
+		if (destP[x] != pixel) {
+			destP[x] = pixel;
+			if (first_x < 0)
+				first_x = x;
+			last_x = x;
+		}
+	}
+}
+
 void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode) {
 	assert(src.w == _screen->w && src.h == _screen->h && src.pitch == _screen->pitch);
-	const uint32 *srcP = (const uint32 *)src.getPixels();
-	uint32 *destP = (uint32 *)_screen->getPixels();
-	uint32 pixel;
 	int x1 = 9999, y1 = 9999, x2 = -1, y2 = -1;
 
 	for (int y = 0; y < src.h; ++y) {
-		for (int x = 0; x < src.w; ++x, ++srcP, ++destP) {
-			if (!mode) {
-				pixel = (*srcP & 0xff00ff00) |
-					((*srcP & 0xff) << 16) |
-					((*srcP >> 16) & 0xff);
-			} else {
-				pixel = ((*srcP & 0xffffff) << 8) |
-					((*srcP >> 24) & 0xff);
-			}
-
-			if (*destP != pixel) {
-				*destP = pixel;
-				x1 = MIN(x1, x);
-				y1 = MIN(y1, y);
-				x2 = MAX(x2, x);
-				y2 = MAX(y2, y);
-			}
+		const uint32 *srcP = (const uint32 *)src.getBasePtr(0, y);
+		uint32 *destP = (uint32 *)_screen->getBasePtr(0, y);
+		int row_x1, row_x2;
+		if (mode)
+			convertARGBRow<true>(srcP, destP, src.w, row_x1, row_x2);
+		else
+			convertARGBRow<false>(srcP, destP, src.w, row_x1, row_x2);
+
+		if (row_x2 != -1) {
+			x1 = MIN(x1, row_x1);
+			x2 = MAX(x2, row_x2);
+			y1 = MIN(y1, y);
+			y2 = y;
 		}
 	}
 
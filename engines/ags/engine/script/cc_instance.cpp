@@ -253,6 +253,7 @@ ccInstance::ccInstance() {
 	numimports = 0;
 	resolved_imports = nullptr;
 	code_fixups         = nullptr;
+	code_ops            = nullptr;
 
 	memset(callStackLineNumber, 0, sizeof(callStackLineNumber));
 	memset(callStackAddr, 0, sizeof(callStackAddr));
@@ -583,17 +584,26 @@ int ccInstance::Run(int32_t curpc) {
 		//
 		/* Read operation */
 		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
+		const ScriptOpHeader *opHeader = (codeInst->code_ops && static_cast<uint32_t>(pc) < static_cast<uint32_t>(codeInst->codesize)) ?
+			&codeInst->code_ops[pc] : nullptr;
+		if (opHeader && opHeader->Valid) {
+			// Already validated when the script was loaded
+			codeOp.Instruction.Code         = opHeader->Code;
+			codeOp.Instruction.InstanceId   = opHeader->InstanceId;
+			codeOp.ArgCount                 = opHeader->ArgCount;
+		} else {
+			codeOp.Instruction.Code         = codeInst->code[pc];
+			codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
+			codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
 
-		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
-							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
+			CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
+								"invalid instruction %d found in code stream", codeOp.Instruction.Code);
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+			codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
 
-		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
-							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
+			CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
+								"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
+		}
 
 
 		// Read arguments; use switch as it proved to be faster than the loop
@@ -1651,6 +1661,7 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 	if (joined) {
 		resolved_imports = joined->resolved_imports;
 		code_fixups = joined->code_fixups;
+		code_ops = joined->code_ops;
 	} else {
 		if (!CreateGlobalVars(scri.get())) {
 			return false;
@@ -1737,9 +1748,11 @@ void ccInstance::Free() {
 	if ((flags & INSTF_SHAREDATA) == 0) {
 		delete[] resolved_imports;
 		delete[] code_fixups;
+		delete[] code_ops;
 	}
 	resolved_imports = nullptr;
 	code_fixups = nullptr;
+	code_ops = nullptr;
 }
 
 bool ccInstance::ResolveScriptImports(const ccScript *scri) {
@@ -1950,9 +1963,33 @@ bool ccInstance::ResolveImportFixups(const ccScript *scri) {
 		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT)
 			code[fixup + 1] = SCMD_CALLAS | (import->InstancePtr->loadedInstanceId << INSTANCE_ID_SHIFT);
 	}
+	// The bytecode is final now; forks share the headers with their parent
+	if ((flags & INSTF_SHAREDATA) == 0 && code_ops == nullptr)
+		CreateOpHeaders();
 	return true;
 }
 
+void ccInstance::CreateOpHeaders() {
+	code_ops = new ScriptOpHeader[codesize];
+	// Walk the instructions in sequence, same as DetermineScriptLine does;
+	// positions past a malformed instruction are left invalid, and Run()
+	// reports the error there as usual
+	for (int32_t pos = 0; pos < codesize; ) {
+		const int op = code[pos] & INSTANCE_ID_REMOVEMASK;
+		if (op < 0 || op >= CC_NUM_SCCMDS)
+			break;
+		const int argCount = (*g_commands)[op].ArgCount;
+		if (pos + argCount >= codesize)
+			break;
+		ScriptOpHeader &header = code_ops[pos];
+		header.Code = static_cast<uint8_t>(op);
+		header.InstanceId = static_cast<uint8_t>((code[pos] >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK);
+		header.ArgCount = static_cast<uint8_t>(argCount);
+		header.Valid = true;
+		pos += argCount + 1;
+	}
+}
+
 void ccInstance::PushValueToStack(const RuntimeScriptValue &rval) {
 	// Write value to the stack tail and advance stack ptr
 	registers[SREG_SP].WriteValue(rval);
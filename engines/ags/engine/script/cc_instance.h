@@ -67,6 +67,15 @@ struct ScriptInstruction {
 	int32_t InstanceId = 0;
 };
 
+// Instruction header decoded once from the fixed up bytecode, so that the
+// interpreter does not have to validate the opcode on each execution
+struct ScriptOpHeader {
+	uint8_t Code = 0;       // pure instruction code
+	uint8_t InstanceId = 0;
+	uint8_t ArgCount = 0;
+	bool    Valid = false;  // a whole instruction starts at this position
+};
+
 struct ScriptOperation {
 	ScriptInstruction   Instruction;
 	RuntimeScriptValue  Args[MAX_SCMD_ARGS];
@@ -154,6 +163,8 @@ public:
 	int  numimports;
 
 	char *code_fixups;
+	// decoded instruction headers, indexed by bytecode position
+	ScriptOpHeader *code_ops;
 
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
@@ -208,6 +219,8 @@ private:
 	bool    AddGlobalVar(const ScriptVariable &glvar);
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(const ccScript *scri);
+	// Decode instruction headers from the final bytecode
+	void    CreateOpHeaders();
 
 	// Begin executing script starting from the given bytecode index
 	int     Run(int32_t curpc);
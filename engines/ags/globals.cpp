@@ -50,6 +50,7 @@
 #include "ags/engine/ac/move_list.h"
 #include "ags/engine/ac/room_status.h"
 #include "ags/engine/ac/route_finder_jps.h"
+#include "ags/engine/ac/route_finder_regions.h"
 #include "ags/engine/ac/screen_overlay.h"
 #include "ags/engine/ac/sprite.h"
 #include "ags/engine/ac/sprite_list_entry.h"
@@ -356,6 +357,7 @@ Globals::Globals() {
 	// route_finder_impl.cpp globals
 	_navpoints = new Point[MAXNEEDSTAGES];
 	_nav = new Navigation();
+	_walkable_regions = new WalkableRegions();
 	_route_finder_impl = new std::unique_ptr<IRouteFinder>();
 
 	// screen.cpp globals
@@ -613,6 +615,7 @@ Globals::~Globals() {
 	// route_finder_impl.cpp globals
 	delete[] _navpoints;
 	delete _nav;
+	delete _walkable_regions;
 
 	// screen.cpp globals
 	delete[] _old_palette;
@@ -108,6 +108,7 @@ class EngineExports;
 
 class IRouteFinder;
 class Navigation;
+class WalkableRegions;
 class SplitLines;
 class TTFFontRenderer;
 class WFNFontRenderer;
@@ -1235,6 +1236,7 @@ public:
 
 	Point *_navpoints;
 	Navigation *_nav;
+	WalkableRegions *_walkable_regions;
 	int _num_navpoints = 0;
 	AGS::Shared::Bitmap *_wallscreen = nullptr;
 	fixed _move_speed_x, _move_speed_y;
@@ -58,6 +58,34 @@ void rotate_scale_coordinates(fixed w, fixed h,
 	ys[br] = ys[tr] + ys[bl] - ys[tl];
 }
 
+/* draw_parallelogram_scanline:
+ *  Draws one scanline for parallelogram_map, when the sprite and the bitmap
+ *  share the same pixel format. Reads and writes the pixels directly, but
+ *  otherwise behaves same as the getpixel()/putpixel() loop.
+ */
+template<typename PixelType>
+static void draw_parallelogram_scanline(BITMAP *bmp, const BITMAP *spr, int bmp_y, int bmp_x1, int bmp_x2,
+		fixed spr_x, fixed spr_y, fixed spr_dx, fixed spr_dy, uint32 transColor, uint32 alphaMask) {
+	Graphics::ManagedSurface &dest = **bmp;
+	const Graphics::ManagedSurface &src = **spr;
+	if (bmp_y < 0 || bmp_y >= dest.h)
+		return;
+
+	PixelType *dest_row = (PixelType *)dest.getBasePtr(0, bmp_y);
+	const byte *src_pixels = (const byte *)src.getBasePtr(0, 0);
+	for (int x = bmp_x1; x <= bmp_x2; ++x) {
+		const int sx = spr_x >> 16;
+		const int sy = spr_y >> 16;
+		// getpixel() returns -1 for the pixels outside of the sprite
+		const uint32 c = ((unsigned)sx < (unsigned)src.w && (unsigned)sy < (unsigned)src.h) ?
+			((const PixelType *)(src_pixels + sy * src.pitch))[sx] : (uint32)-1;
+		if ((c & alphaMask) != transColor && (unsigned)x < (unsigned)dest.w)
+			dest_row[x] = (PixelType)c;
+		spr_x += spr_dx;
+		spr_y += spr_dy;
+	}
+}
+
 /* parallelogram_map:
  *  Worker routine for drawing rotated and/or scaled and/or flipped sprites:
  *  It actually maps the sprite to any parallelogram-shaped area of the
@@ -335,6 +363,24 @@ void parallelogram_map(BITMAP *bmp, const BITMAP *spr, fixed xs[4], fixed ys[4])
 			// draw scanline
 			int r_bmp_x_i = (r_bmp_x_rounded >> 16);
 			int l_bmp_x_i = (l_bmp_x_rounded >> 16);
+			if (sameFormat) {
+				switch (bmp->format.bytesPerPixel) {
+				case 1:
+					draw_parallelogram_scanline<uint8>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, transColor, alphaMask);
+					goto skip_draw;
+				case 2:
+					draw_parallelogram_scanline<uint16>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, transColor, alphaMask);
+					goto skip_draw;
+				case 4:
+					draw_parallelogram_scanline<uint32>(bmp, spr, bmp_y_i, l_bmp_x_i, r_bmp_x_i,
+						l_spr_x_rounded, l_spr_y_rounded, spr_dx, spr_dy, transColor, alphaMask);
+					goto skip_draw;
+				default:
+					break;
+				}
+			}
 			for (; l_bmp_x_i <= r_bmp_x_i; ++l_bmp_x_i) {
 				uint32 c = (uint32)getpixel(spr, l_spr_x_rounded >> 16, l_spr_y_rounded >> 16);
 				if ((c & alphaMask) != transColor) {
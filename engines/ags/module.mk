@@ -175,6 +175,7 @@ MODULE_OBJS = \
 	engine/ac/route_finder_impl.o \
 	engine/ac/route_finder_impl_legacy.o \
 	engine/ac/route_finder_jps.o \
+	engine/ac/route_finder_regions.o \
 	engine/ac/screen.o \
 	engine/ac/screen_overlay.o \
 	engine/ac/script_containers.o \
@@ -44,6 +44,7 @@
 #include "ags/engine/ac/parser.h"
 #include "ags/engine/ac/path_helper.h"
 #include "ags/engine/ac/room_status.h"
+#include "ags/engine/ac/route_finder_regions.h"
 #include "ags/engine/ac/string.h"
 #include "ags/engine/ac/sys_events.h"
 #include "ags/shared/ac/sprite_cache.h"
@@ -423,9 +424,11 @@ BITMAP *IAGSEngine::GetSpriteGraphic(int32 num) {
 	return (BITMAP *)_GP(spriteset)[num]->GetAllegroBitmap();
 }
 BITMAP *IAGSEngine::GetRoomMask(int32 index) {
-	if (index == MASK_WALKABLE)
+	if (index == MASK_WALKABLE) {
+		// the plugin may draw on the mask
+		_GP(walkable_regions).Invalidate();
 		return (BITMAP *)_GP(thisroom).WalkAreaMask->GetAllegroBitmap();
-	else if (index == MASK_WALKBEHIND)
+	} else if (index == MASK_WALKBEHIND)
 		return (BITMAP *)_GP(thisroom).WalkBehindMask->GetAllegroBitmap();
 	else if (index == MASK_HOTSPOT)
 		return (BITMAP *)_GP(thisroom).HotspotMask->GetAllegroBitmap();
@@ -323,6 +323,25 @@ void SpriteCache::PrecacheSprite(sprkey_t index) {
 	SprCacheLog("Precached %d", index);
 }
 
+void SpriteCache::PrefetchSprite(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return;
+	if (!_spriteData[index].IsAssetSprite() || _spriteData[index].IsError() ||
+		_spriteData[index].Image)
+		return; // not an asset sprite, or it's already loaded
+
+	// Don't bother reading the sprite if it's clear that it won't fit;
+	// its real size is only known after loading and initializing it
+	const size_t min_size = _sprInfos[index].Width * _sprInfos[index].Height;
+	if (_cacheSize + min_size >= _maxCacheSize)
+		return;
+
+	if (LoadSprite(index, false, true) && !_spriteData[index].IsLocked()) {
+		_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
+		SprCacheLog("Prefetched %d", index);
+	}
+}
+
 void SpriteCache::LockSprite(sprkey_t index) {
 	assert(index >= 0); // out of positive range indexes are valid to fail
 	if (index < 0 || (size_t)index >= _spriteData.size())
@@ -350,7 +369,7 @@ void SpriteCache::UnlockSprite(sprkey_t index) {
 	SprCacheLog("Unlocked %d", index);
 }
 
-size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
+size_t SpriteCache::LoadSprite(sprkey_t index, bool lock, bool no_evict) {
 	assert((index >= 0) && ((size_t)index < _spriteData.size()));
 	if (index < 0 || (size_t)index >= _spriteData.size())
 		return 0;
@@ -375,11 +394,17 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 		return 0;
 	}
 
+	const size_t size = image->GetWidth() * image->GetHeight() * image->GetBPP();
+	// FreeMem() would dispose other sprites unless there's this much space
+	if (no_evict && (_cacheSize + size >= _maxCacheSize)) {
+		delete image;
+		return 0;
+	}
+
 	// save the stored sprite info
 	_sprInfos[index].Width = image->GetWidth();
 	_sprInfos[index].Height = image->GetHeight();
 	// Clear up space before adding to cache
-	const size_t size = image->GetWidth() * image->GetHeight() * image->GetBPP();
 	FreeMem(size);
 	// Add to the cache, lock if requested or if it's sprite 0
 	const bool should_lock = lock || (index == 0);
@@ -138,6 +138,10 @@ public:
 	// Loads sprite using SpriteFile if such index is known,
 	// frees the space if cache size reaches the limit
 	void        PrecacheSprite(sprkey_t index);
+	// Loads sprite using SpriteFile ahead of its use, but only if the cache
+	// has enough free space for it; unlike PrecacheSprite this does not lock
+	// the sprite and never disposes other sprites
+	void        PrefetchSprite(sprkey_t index);
 	// Locks sprite, preventing it from getting removed by the normal cache limit.
 	// If this is a registered sprite from the game assets, then loads it first.
 	// If this is a sprite with SPRCACHEFLAG_EXTERNAL flag, then does nothing,
@@ -174,8 +178,9 @@ public:
 	Bitmap *operator[](sprkey_t index);
 
 private:
-	// Load sprite from game resource
-	size_t      LoadSprite(sprkey_t index, bool lock = false);
+	// Load sprite from game resource; if no_evict is set, then the sprite is
+	// discarded instead of disposing other sprites to make space for it
+	size_t      LoadSprite(sprkey_t index, bool lock = false, bool no_evict = false);
 	// Remap the given index to the placeholder
 	void        RemapSpriteToPlaceholder(sprkey_t index);
 	// Delete the oldest (least recently used) image in cache
@@ -55,10 +55,12 @@ void WorklistManager::push(reg_t reg) {
 
 	debugC(kDebugLevelGC, "[GC] Adding %04x:%04x", PRINT_REG(reg));
 
-	if (_map.contains(reg))
+	// operator[] inserts the key if it is new, so this is a single probe
+	bool &seen = _map[reg];
+	if (seen)
 		return; // already dealt with it
 
-	_map.setVal(reg, true);
+	seen = true;
 	_worklist.push_back(reg);
 }
 
@@ -83,6 +85,32 @@ static AddrSet *normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_
 	return normal_map;
 }
 
+/**
+ * Adds the canonical form of every address in the set to the set itself.
+ * Unlike normalizeAddresses(), this keeps the non-canonical entries, which
+ * is fine for the sweep: deallocatable addresses are always canonical, and
+ * a non-canonical address never equals one. Most references (clones, lists,
+ * nodes, hunks, arrays) are canonical already, so this only inserts the few
+ * script, locals and stack references instead of copying the whole set.
+ */
+static void addCanonicalAddresses(SegManager *segMan, AddrSet &map) {
+	Common::Array<reg_t> canonical;
+
+	for (AddrSet::const_iterator i = map.begin(); i != map.end(); ++i) {
+		const reg_t reg = i->_key;
+		SegmentObj *mobj = segMan->getSegmentObj(reg.getSegment());
+
+		if (mobj) {
+			const reg_t canonicalReg = mobj->findCanonicAddress(segMan, reg);
+			if (canonicalReg != reg)
+				canonical.push_back(canonicalReg);
+		}
+	}
+
+	for (Common::Array<reg_t>::const_iterator it = canonical.begin(); it != canonical.end(); ++it)
+		map[*it] = true;
+}
+
 static void processWorkList(SegManager *segMan, WorklistManager &wm, const Common::Array<SegmentObj *> &heap) {
 	SegmentId stackSegment = segMan->findSegmentByType(SEG_TYPE_STACK);
 	while (!wm._worklist.empty()) {
@@ -98,11 +126,9 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 	}
 }
 
-AddrSet *findAllActiveReferences(EngineState *s) {
+static void markActiveReferences(EngineState *s, WorklistManager &wm) {
 	assert(!s->_executionStack.empty());
 
-	WorklistManager wm;
-
 	// Initialize registers
 	wm.push(s->r_acc);
 	wm.push(s->r_prev);
@@ -174,7 +200,11 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 	if (g_sci->_gfxPorts)
 		g_sci->_gfxPorts->processEngineHunkList(wm);
+}
 
+AddrSet *findAllActiveReferences(EngineState *s) {
+	WorklistManager wm;
+	markActiveReferences(s, wm);
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
@@ -191,7 +221,10 @@ void run_gc(EngineState *s) {
 #endif
 
 	// Compute the set of all segments references currently in use.
-	AddrSet *activeRefs = findAllActiveReferences(s);
+	WorklistManager wm;
+	markActiveReferences(s, wm);
+	addCanonicalAddresses(segMan, wm._map);
+	const AddrSet &activeRefs = wm._map;
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
@@ -210,7 +243,7 @@ void run_gc(EngineState *s) {
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
-				if (!activeRefs->contains(addr)) {
+				if (!activeRefs.contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
@@ -223,7 +256,8 @@ void run_gc(EngineState *s) {
 		}
 	}
 
-	delete activeRefs;
+	// Freed clones must not be found through stale selector lookups
+	segMan->invalidateSelectorCache();
 
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
@@ -56,7 +56,7 @@ void run_gc(EngineState *s);
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
-	AddrSet _map;	// used for 2 contains() calls, inside push() and run_gc()
+	AddrSet _map;	// addresses already queued, probed once per push()
 
 	void push(reg_t reg);
 	void pushArray(const Common::Array<reg_t> &tmp);
@@ -116,10 +116,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Index in the cached visibility graph, -1 for start and end points
+	int graphIndex;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = nullptr;
+		graphIndex = -1;
 	}
 };
 
@@ -262,6 +266,13 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Cached visibility between obstacle vertices, or NULL if the
+	// obstacle edges were changed while merging the start and end points
+	AvoidPathGraph *_graph;
+
+	// Set when merging the start or end point split an obstacle edge
+	bool _edgeSplit;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = nullptr;
 		vertex_end = nullptr;
@@ -269,6 +280,8 @@ struct PathfindingState {
 		_prependPoint = nullptr;
 		_appendPoint = nullptr;
 		vertices = 0;
+		_graph = nullptr;
+		_edgeSplit = false;
 	}
 
 	~PathfindingState() {
@@ -698,6 +711,39 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether or not one vertex is visible from another
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if the line between the two vertices is unobstructed
+ */
+static bool vertex_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -707,33 +753,28 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
 
+	// Visibility between two obstacle vertices only depends on the
+	// obstacle edges, so it can be taken from the cached graph. The start
+	// and end points never add edges, but they may be anywhere.
+	AvoidPathGraph *graph = s->_graph;
+	byte *row = nullptr;
+	if (graph && vertex_cur->graphIndex >= 0)
+		row = &graph->visibility[vertex_cur->graphIndex * graph->vertexCount];
+
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
+		bool visible;
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
-
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
-
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
+		if (row && vertex->graphIndex >= 0) {
+			byte &entry = row[vertex->graphIndex];
+			if (!entry)
+				entry = vertex_visible(s, vertex_cur, vertex) ? 1 : 2;
+			visible = (entry == 1);
+		} else {
+			visible = vertex_visible(s, vertex_cur, vertex);
 		}
 
-		if (j == s->vertices)
+		if (visible)
 			visVerts->push_front(vertex);
 	}
 
@@ -1146,6 +1187,7 @@ static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
 				if (between(vertex->v, next->v, v)) {
 					// Split edge by adding vertex
 					polygon->vertices.insertAfter(vertex, v_new);
+					s->_edgeSplit = true;
 					return v_new;
 				}
 			}
@@ -1235,6 +1277,64 @@ static void change_polygons_opt_0(PathfindingState *s) {
 	}
 }
 
+/**
+ * Numbers the obstacle vertices and looks up the visibility graph cached for
+ * this exact obstacle set, replacing the least recently used graph if there
+ * is none. Polygons are compared by content, so changes made by the scripts
+ * are picked up without any explicit invalidation.
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) p: The pathfinding state
+ * Returns   : (AvoidPathGraph *) The graph, or NULL if the set is too large
+ */
+static AvoidPathGraph *find_visibility_graph(EngineState *s, PathfindingState *p) {
+	// Larger sets are rare and would need a lot of memory
+	const uint kMaxGraphVertices = 256;
+
+	Common::Array<int16> key;
+	uint count = 0;
+
+	for (PolygonList::iterator it = p->polygons.begin(); it != p->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		key.push_back(polygon->type);
+		key.push_back(polygon->vertices.size());
+
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->graphIndex = count++;
+			key.push_back(vertex->v.x);
+			key.push_back(vertex->v.y);
+		}
+	}
+
+	if (count > kMaxGraphVertices)
+		return nullptr;
+
+	AvoidPathGraph *graph = nullptr;
+
+	for (uint i = 0; i < EngineState::kAvoidPathGraphCount; i++) {
+		AvoidPathGraph &entry = s->_avoidPathGraphs[i];
+
+		if (entry.vertexCount == count && entry.polygons == key) {
+			graph = &entry;
+			break;
+		}
+
+		if (!graph || entry.lastUsed < graph->lastUsed)
+			graph = &entry;
+	}
+
+	if (graph->vertexCount != count || graph->polygons != key) {
+		graph->polygons = key;
+		graph->vertexCount = count;
+		graph->visibility.clear();
+		graph->visibility.resize(count * count);
+	}
+
+	graph->lastUsed = ++s->_avoidPathGraphStamp;
+	return graph;
+}
+
 /**
  * Converts the SCI input data for pathfinding
  * Parameters: (EngineState *) s: The game state
@@ -1326,6 +1426,8 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	AvoidPathGraph *graph = find_visibility_graph(s, pf_s);
+
 	// Merge start and end points into polygon set
 	pf_s->vertex_start = merge_point(pf_s, *new_start);
 	pf_s->vertex_end = merge_point(pf_s, *new_end);
@@ -1333,6 +1435,10 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	delete new_start;
 	delete new_end;
 
+	// A split edge changes what the obstacle vertices can see
+	if (!pf_s->_edgeSplit)
+		pf_s->_graph = graph;
+
 	// Allocate and build vertex index
 	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * (count + 2));
 
@@ -336,6 +336,9 @@ void SegManager::saveLoadWithSerializer(Common::Serializer &s) {
 #endif
 			}
 		}
+
+		// Objects were set up in place, after the segments were allocated
+		invalidateSelectorCache();
 	}
 }
 
@@ -47,6 +47,10 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_bitmapSegId = 0;
 #endif
 
+	for (uint i = 0; i < kSelectorCacheSize; i++)
+		_selectorCache[i].generation = 0;
+	_selectorCacheGeneration = 1;
+
 	createClassTable();
 }
 
@@ -113,6 +117,8 @@ SegmentId SegManager::allocSegment(SegmentObj *mobj) {
 	if (!mobj)
 		error("SegManager: invalid mobj");
 
+	invalidateSelectorCache();
+
 	// Find a free segment
 	SegmentId id = findFreeSegment();
 
@@ -180,6 +186,8 @@ void SegManager::deallocate(SegmentId seg) {
 
 	delete mobj;
 	_heap[actualSegment] = nullptr;
+
+	invalidateSelectorCache();
 }
 
 bool SegManager::isHeapObject(reg_t pos) const {
@@ -493,10 +501,36 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 
 	int offset = table->allocEntry();
 
+	// Growing the table may have reused the address of a freed clone
+	invalidateSelectorCache();
+
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
 }
 
+bool SegManager::findCachedSelector(reg_t obj, Selector selectorId, SelectorType &type, int &varIndex, reg_t &funcAddr) const {
+	const SelectorCacheEntry &entry = _selectorCache[selectorCacheSlot(obj, selectorId)];
+
+	if (entry.generation != _selectorCacheGeneration || entry.obj != obj || entry.selectorId != selectorId)
+		return false;
+
+	type = entry.type;
+	varIndex = entry.varIndex;
+	funcAddr = entry.funcAddr;
+	return true;
+}
+
+void SegManager::cacheSelector(reg_t obj, Selector selectorId, SelectorType type, int varIndex, reg_t funcAddr) {
+	SelectorCacheEntry &entry = _selectorCache[selectorCacheSlot(obj, selectorId)];
+
+	entry.generation = _selectorCacheGeneration;
+	entry.obj = obj;
+	entry.selectorId = selectorId;
+	entry.type = type;
+	entry.varIndex = varIndex;
+	entry.funcAddr = funcAddr;
+}
+
 List *SegManager::allocateList(reg_t *addr) {
 	ListTable *table;
 
@@ -1102,6 +1136,10 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	scr->load(scriptNum, _resMan, _scriptPatcher, applyScriptPatches);
 	scr->initializeLocals(this);
 	scr->initializeObjects(this, segmentId, applyScriptPatches);
+
+	// The script may have been reloaded in place, over a disposed copy
+	invalidateSelectorCache();
+
 #ifdef ENABLE_SCI32
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
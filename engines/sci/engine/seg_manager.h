@@ -460,7 +460,46 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	// Selector lookup cache
+
+	/**
+	 * Looks up a previously resolved (object, selector) pair.
+	 * @return true on a hit, with the results of lookupSelector() filled in
+	 */
+	bool findCachedSelector(reg_t obj, Selector selectorId, SelectorType &type, int &varIndex, reg_t &funcAddr) const;
+
+	/**
+	 * Remembers the result of a lookupSelector() call.
+	 */
+	void cacheSelector(reg_t obj, Selector selectorId, SelectorType type, int varIndex, reg_t funcAddr);
+
+	/**
+	 * Drops all cached selector lookups. Must be called whenever objects may
+	 * have been created, moved, reloaded or freed.
+	 */
+	void invalidateSelectorCache() { _selectorCacheGeneration++; }
+
 private:
+	enum {
+		kSelectorCacheSize = 1024
+	};
+
+	struct SelectorCacheEntry {
+		uint32 generation;
+		reg_t obj;
+		Selector selectorId;
+		SelectorType type;
+		int varIndex;
+		reg_t funcAddr;
+	};
+
+	SelectorCacheEntry _selectorCache[kSelectorCacheSize];
+	uint32 _selectorCacheGeneration;
+
+	static uint selectorCacheSlot(reg_t obj, Selector selectorId) {
+		return ((obj.getSegment() * 31 + obj.getOffset()) * 17 + selectorId) & (kSelectorCacheSize - 1);
+	}
+
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
 	/** Map script ids to segment ids. */
@@ -323,14 +323,11 @@ void invokeSelector(EngineState *s, reg_t object, int selectorId,
 	run_vm(s); // Start a new vm
 }
 
-SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
+static SelectorType lookupSelectorUncached(SegManager *segMan, reg_t obj_location, Selector selectorId, int &varIndex, reg_t &funcAddr) {
 	const Object *obj = segMan->getObject(obj_location);
-	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
 
-	// Early SCI versions used the LSB in the selector ID as a read/write
-	// toggle, meaning that we must remove it for selector lookup.
-	if (oldScriptHeader)
-		selectorId &= ~1;
+	varIndex = -1;
+	funcAddr = NULL_REG;
 
 	if (!obj) {
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
@@ -340,27 +337,52 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 
 	if (index >= 0) {
 		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
+		varIndex = index;
 		return kSelectorVariable;
-	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
-			}
+	}
+
+	// Check if it's a method, with recursive lookup in superclasses
+	while (obj) {
+		index = obj->funcSelectorPosition(selectorId);
+		if (index >= 0) {
+			funcAddr = obj->getFunction(index);
+			return kSelectorMethod;
+		} else {
+			obj = segMan->getObject(obj->getSuperClassSelector());
 		}
+	}
 
-		return kSelectorNone;
+	return kSelectorNone;
+}
+
+SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector selectorId, ObjVarRef *varp, reg_t *fptr) {
+	bool oldScriptHeader = (getSciVersion() == SCI_VERSION_0_EARLY);
+
+	// Early SCI versions used the LSB in the selector ID as a read/write
+	// toggle, meaning that we must remove it for selector lookup.
+	if (oldScriptHeader)
+		selectorId &= ~1;
+
+	SelectorType type;
+	int varIndex;
+	reg_t funcAddr;
+
+	if (!segMan->findCachedSelector(obj_location, selectorId, type, varIndex, funcAddr)) {
+		type = lookupSelectorUncached(segMan, obj_location, selectorId, varIndex, funcAddr);
+		segMan->cacheSelector(obj_location, selectorId, type, varIndex, funcAddr);
 	}
+
+	if (type == kSelectorVariable) {
+		if (varp) {
+			varp->obj = obj_location;
+			varp->varindex = varIndex;
+		}
+	} else if (type == kSelectorMethod) {
+		if (fptr)
+			*fptr = funcAddr;
+	}
+
+	return type;
 }
 
 } // End of namespace Sci
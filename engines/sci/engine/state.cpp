@@ -69,7 +69,8 @@ static const uint16 s_halfWidthSJISMap[256] = {
 EngineState::EngineState(SegManager *segMan) :
 	_segMan(segMan),
 	_msgState(nullptr),
-	_dirseeker() {
+	_dirseeker(),
+	_avoidPathGraphStamp(0) {
 
 	reset(false);
 }
@@ -97,6 +97,20 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Visibility graph of a kAvoidPath obstacle set, kept between calls so that
+ * pathfinding through an unchanged set only has to test the start and end
+ * points against it. See kpathing.cpp.
+ */
+struct AvoidPathGraph {
+	Common::Array<int16> polygons; ///< Flattened obstacle set the graph belongs to
+	Common::Array<byte> visibility; ///< Vertex pair visibility, 0 if not computed yet
+	uint vertexCount;
+	uint32 lastUsed;
+
+	AvoidPathGraph() : vertexCount(0), lastUsed(0) {}
+};
+
 struct EngineState : public Common::Serializable {
 	EngineState(SegManager *segMan);
 	~EngineState() override;
@@ -200,6 +214,13 @@ struct EngineState : public Common::Serializable {
 	uint16 _memorySegmentSize;
 	byte _memorySegment[kMemorySegmentMax];
 
+	// see kpathing.cpp / kAvoidPath()
+	enum {
+		kAvoidPathGraphCount = 4
+	};
+	AvoidPathGraph _avoidPathGraphs[kAvoidPathGraphCount];
+	uint32 _avoidPathGraphStamp;
+
 	/**
 	 * Resets the engine state.
 	 */
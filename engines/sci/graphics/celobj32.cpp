@@ -91,6 +91,9 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler = new CelScaler();
 	_cache = new CelCache(100);
+	_cacheIndex = new CelCacheIndex();
+	_pixelCache = new CelPixelCache();
+	_pixelCacheSize = 0;
 }
 
 void CelObj::deinit() {
@@ -98,6 +101,11 @@ void CelObj::deinit() {
 	_scaler = nullptr;
 	delete _cache;
 	_cache = nullptr;
+	delete _cacheIndex;
+	_cacheIndex = nullptr;
+	delete _pixelCache;
+	_pixelCache = nullptr;
+	_pixelCacheSize = 0;
 }
 
 #pragma mark -
@@ -364,6 +372,8 @@ struct READER_Compressed {
 private:
 	const SciSpan<const byte> _resource;
 	byte _buffer[kCelScalerTableSize];
+	const byte *_pixels;
+	const int16 _width;
 	uint32 _controlOffset;
 	uint32 _dataOffset;
 	uint32 _uncompressedDataOffset;
@@ -373,8 +383,10 @@ private:
 	const int16 _maxWidth;
 
 public:
-	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
+	READER_Compressed(const CelObj &celObj, const int16 maxWidth, const bool useCache = true) :
 	_resource(celObj.getResPointer()),
+	_pixels(useCache ? celObj.getCachedPixels() : nullptr),
+	_width(celObj._width),
 	_y(-1),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
@@ -389,6 +401,10 @@ public:
 
 	inline const byte *getRow(const int16 y) {
 		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels + y * _width;
+		}
+
 		if (y != _y) {
 			// compressed data segment for row
 			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
@@ -700,9 +716,25 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
+CelCacheIndex *CelObj::_cacheIndex = nullptr;
+CelPixelCache *CelObj::_pixelCache = nullptr;
+uint32 CelObj::_pixelCacheSize = 0;
+
+#ifdef REDUCE_MEMORY_USAGE
+static const uint32 kCelPixelCacheBudget = 1024 * 1024;
+#else
+static const uint32 kCelPixelCacheBudget = 6 * 1024 * 1024;
+#endif
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
+
+	CelCacheIndex::const_iterator it = _cacheIndex->find(celInfo);
+	if (it != _cacheIndex->end()) {
+		(*_cache)[it->_value].id = ++_nextCacheId;
+		return it->_value;
+	}
+
 	int oldestId = _nextCacheId + 1;
 	int oldestIndex = 0;
 
@@ -713,9 +745,6 @@ int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) co
 			if (*nextInsertIndex == -1) {
 				*nextInsertIndex = i;
 			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
 		} else if (oldestId > entry.id) {
 			oldestId = entry.id;
 			oldestIndex = i;
@@ -735,8 +764,56 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	}
 
 	CelCacheEntry &entry = (*_cache)[cacheIndex];
+	if (entry.celObj) {
+		_cacheIndex->erase(entry.celObj->_info);
+	}
 	entry.celObj.reset(duplicate());
 	entry.id = ++_nextCacheId;
+	(*_cacheIndex)[_info] = cacheIndex;
+}
+
+const byte *CelObj::getCachedPixels() const {
+	// Memory bitmaps can be changed by scripts at any time, so only cels
+	// backed by resources are safe to keep decompressed
+	if (_info.type != kCelTypeView && _info.type != kCelTypePic) {
+		return nullptr;
+	}
+
+	const uint32 size = _width * _height;
+	if (size == 0 || size > kCelPixelCacheBudget / 4) {
+		return nullptr;
+	}
+
+	CelPixelCache::iterator it = _pixelCache->find(_info);
+	if (it != _pixelCache->end()) {
+		it->_value.id = ++_nextCacheId;
+		return it->_value.pixels.begin();
+	}
+
+	while (_pixelCacheSize + size > kCelPixelCacheBudget && !_pixelCache->empty()) {
+		CelPixelCache::iterator oldest = _pixelCache->begin();
+		for (CelPixelCache::iterator candidate = _pixelCache->begin(); candidate != _pixelCache->end(); ++candidate) {
+			if (candidate->_value.id < oldest->_value.id) {
+				oldest = candidate;
+			}
+		}
+
+		_pixelCacheSize -= oldest->_value.pixels.size();
+		_pixelCache->erase(oldest);
+	}
+
+	CelPixelCacheEntry &entry = (*_pixelCache)[_info];
+	entry.id = ++_nextCacheId;
+	entry.pixels.resize(size);
+	_pixelCacheSize += size;
+
+	READER_Compressed reader(*this, _width, false);
+	byte *target = entry.pixels.begin();
+	for (int16 y = 0; y < _height; ++y, target += _width) {
+		memcpy(target, reader.getRow(y), _width);
+	}
+
+	return entry.pixels.begin();
 }
 
 #pragma mark -
@@ -22,6 +22,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -105,7 +106,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +116,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -135,6 +136,16 @@ struct CelInfo32 {
 	}
 };
 
+/**
+ * Hashes the same fields that CelInfo32::operator== compares.
+ */
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &x) const {
+		return ((uint)x.type << 28) ^ ((uint)x.resourceId << 12) ^ ((uint)(uint16)x.loopNo << 6) ^
+			(uint16)x.celNo ^ ((uint)x.bitmap.getSegment() << 16) ^ x.bitmap.getOffset();
+	}
+};
+
 class CelObj;
 struct CelCacheEntry {
 	/**
@@ -148,6 +159,31 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+/**
+ * Maps the CelInfo32 of every occupied CelCache slot to the slot index.
+ */
+typedef Common::HashMap<CelInfo32, int, CelInfo32_Hash> CelCacheIndex;
+
+struct CelPixelCacheEntry {
+	/**
+	 * The cache ID of the last use of these pixels, used to identify the least
+	 * recently used entry for eviction.
+	 */
+	int id;
+
+	/**
+	 * The decompressed pixels of the cel, one row of _width bytes per line.
+	 */
+	Common::Array<byte> pixels;
+
+	CelPixelCacheEntry() : id(0) {}
+};
+
+/**
+ * A cache of decompressed pixel data for RLE compressed view and pic cels.
+ */
+typedef Common::HashMap<CelInfo32, CelPixelCacheEntry, CelInfo32_Hash> CelPixelCache;
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -462,6 +498,12 @@ protected:
 	 */
 	static CelCache *_cache;
 
+	/**
+	 * An index of `_cache` by CelInfo32, so lookups do not need to scan every
+	 * cache slot.
+	 */
+	static CelCacheIndex *_cacheIndex;
+
 	/**
 	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
 	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
@@ -474,6 +516,26 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+	/**
+	 * A cache of decompressed pixels for compressed cels, so that RLE data
+	 * only needs to be decoded once instead of on every draw. Its size is
+	 * limited by the number of bytes held rather than by a number of entries.
+	 */
+	static CelPixelCache *_pixelCache;
+
+	/**
+	 * The total number of pixel bytes held by `_pixelCache`.
+	 */
+	static uint32 _pixelCacheSize;
+
+public:
+	/**
+	 * Returns the decompressed pixels of this cel, decoding and caching them
+	 * first if needed. Returns null if this cel cannot be cached, in which
+	 * case rows must be decompressed while drawing.
+	 */
+	const byte *getCachedPixels() const;
 };
 
 #pragma mark -
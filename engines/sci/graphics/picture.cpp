@@ -20,7 +20,6 @@
  */
 
 #include "common/span.h"
-#include "common/stack.h"
 #include "common/system.h"
 
 #include "sci/sci.h"
@@ -804,7 +803,7 @@ void GfxPicture::vectorGetPatternTexture(const SciSpan<const byte> &data, uint &
 // code. This algo really needs to behave exactly as the one from sierra.
 void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, byte control) {
 	Port *curPort = _ports->getPort();
-	Common::Stack<Common::Point> stack;
+	Common::Array<Common::Point> &stack = _floodFillStack;
 	Common::Point p, p1;
 	byte screenMask = _screen->getDrawingMask(color, priority, control);
 	byte matchedMask, matchMask;
@@ -876,10 +875,12 @@ void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, by
 	_screen->vectorAdjustCoordinate(&borderRight, &borderBottom);
 	//return;
 
-	stack.push(p);
+	// The stack always drains completely, so its storage is simply reused
+	stack.push_back(p);
 
-	while (stack.size()) {
-		p = stack.pop();
+	while (!stack.empty()) {
+		p = stack.back();
+		stack.pop_back();
 		if ((matchedMask = _screen->vectorIsFillMatch(p.x, p.y, matchMask, searchColor, searchPriority, searchControl, isEGA)) == 0) // already filled
 			continue;
 		_screen->vectorPutPixel(p.x, p.y, screenMask, color, priority, control);
@@ -903,7 +904,7 @@ void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, by
 				if (a_set == 0) {
 					p1.x = curToLeft;
 					p1.y = p.y - 1;
-					stack.push(p1);
+					stack.push_back(p1);
 					a_set = 1;
 				}
 			} else
@@ -913,7 +914,7 @@ void GfxPicture::vectorFloodFill(int16 x, int16 y, byte color, byte priority, by
 				if (b_set == 0) {
 					p1.x = curToLeft;
 					p1.y = p.y + 1;
-					stack.push(p1);
+					stack.push_back(p1);
 					b_set = 1;
 				}
 			} else
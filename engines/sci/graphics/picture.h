@@ -22,6 +22,9 @@
 #ifndef SCI_GRAPHICS_PICTURE_H
 #define SCI_GRAPHICS_PICTURE_H
 
+#include "common/array.h"
+#include "common/rect.h"
+
 #include "sci/util.h"
 
 namespace Sci {
@@ -93,6 +96,10 @@ private:
 
 	// If true, we will show the whole EGA drawing process...
 	bool _EGAdrawingVisualize;
+
+	// Scanline seed stack for vectorFloodFill, kept so that the many fills of
+	// one picture don't each regrow their own stack
+	Common::Array<Common::Point> _floodFillStack;
 };
 
 } // End of namespace Sci
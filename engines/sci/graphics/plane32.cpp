@@ -314,6 +314,41 @@ void Plane::breakEraseListByPlanes(RectList &eraseList, const PlaneList &planeLi
 	eraseList.pack();
 }
 
+namespace {
+/**
+ * The smallest box that every rect which intersects one of the added rects
+ * must also intersect. Unlike Common::Rect::extend, this also accounts for
+ * empty rects, since Common::Rect::intersects can be true for those.
+ */
+struct StaticItemBounds {
+	bool _empty;
+	int16 _left, _top, _right, _bottom;
+
+	StaticItemBounds() : _empty(true), _left(0), _top(0), _right(0), _bottom(0) {}
+
+	void add(const Common::Rect &rect) {
+		if (_empty) {
+			_left = rect.left;
+			_top = rect.top;
+			_right = rect.right;
+			_bottom = rect.bottom;
+			_empty = false;
+		} else {
+			_left = MIN(_left, rect.left);
+			_top = MIN(_top, rect.top);
+			_right = MAX(_right, rect.right);
+			_bottom = MAX(_bottom, rect.bottom);
+		}
+	}
+
+	bool intersects(const Common::Rect &rect) const {
+		return !_empty &&
+			rect.left < _right && _left < rect.right &&
+			rect.top < _bottom && _top < rect.bottom;
+	}
+};
+} // End of anonymous namespace
+
 void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList &drawList, RectList &eraseList) {
 	const ScreenItemList::size_type screenItemCount = _screenItemList.size();
 	const ScreenItemList::size_type visiblePlaneItemCount = visiblePlane._screenItemList.size();
@@ -431,6 +466,21 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 	DrawList::size_type drawListSizePrimary = drawList.size();
 	const RectList::size_type eraseListCount = eraseList.size();
 
+	// Only items that are not being created, updated or deleted get added
+	// to the draw list by the loops below (except for SCI3, which has its
+	// own rules), so collect those once together with the bounds of their
+	// rects, instead of filtering every screen item again for each erase
+	// rect and draw list entry
+	Common::Array<ScreenItemList::size_type> staticItems;
+	StaticItemBounds staticItemsBounds;
+	for (ScreenItemList::size_type j = 0; j < screenItemCount && j < _screenItemList.size(); ++j) {
+		const ScreenItem *item = _screenItemList[j];
+		if (item != nullptr && !item->_created && !item->_updated && !item->_deleted) {
+			staticItems.push_back(j);
+			staticItemsBounds.add(item->_screenRect);
+		}
+	}
+
 	if (getSciVersion() == SCI_VERSION_3) {
 		_screenItemList.sort();
 		bool pictureDrawn = false;
@@ -478,13 +528,13 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 		// Add all items overlapping the erase list to the draw list
 		for (RectList::size_type i = 0; i < eraseListCount; ++i) {
 			const Common::Rect &rect = *eraseList[i];
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
-				ScreenItem *item = _screenItemList[j];
-				if (
-					item != nullptr &&
-					!item->_created && !item->_updated && !item->_deleted &&
-					rect.intersects(item->_screenRect)
-				) {
+			if (!staticItemsBounds.intersects(rect)) {
+				continue;
+			}
+
+			for (Common::Array<ScreenItemList::size_type>::const_iterator it = staticItems.begin(); it != staticItems.end(); ++it) {
+				ScreenItem *item = _screenItemList[*it];
+				if (rect.intersects(item->_screenRect)) {
 					drawList.add(item, rect.findIntersectingRect(item->_screenRect));
 				}
 			}
@@ -504,23 +554,19 @@ void Plane::calcLists(Plane &visiblePlane, const PlaneList &planeList, DrawList
 				drawListEntry = drawList[i];
 			}
 
-			for (ScreenItemList::size_type j = 0; j < screenItemCount; ++j) {
-				ScreenItem *newItem = nullptr;
-				if (j < _screenItemList.size()) {
-					newItem = _screenItemList[j];
-				}
+			if (drawListEntry == nullptr || !staticItemsBounds.intersects(drawListEntry->rect)) {
+				continue;
+			}
 
-				if (
-					drawListEntry != nullptr && newItem != nullptr &&
-					!newItem->_created && !newItem->_updated && !newItem->_deleted
-				) {
-					const ScreenItem *drawnItem = drawListEntry->screenItem;
+			const ScreenItem *drawnItem = drawListEntry->screenItem;
+			for (Common::Array<ScreenItemList::size_type>::const_iterator it = staticItems.begin(); it != staticItems.end(); ++it) {
+				const ScreenItemList::size_type j = *it;
+				ScreenItem *newItem = _screenItemList[j];
 
-					if (newItem->hasPriorityAbove(*drawnItem) &&
-						drawListEntry->rect.intersects(newItem->_screenRect)
-					) {
-						mergeToDrawList(j, drawListEntry->rect.findIntersectingRect(newItem->_screenRect), drawList);
-					}
+				if (newItem->hasPriorityAbove(*drawnItem) &&
+					drawListEntry->rect.intersects(newItem->_screenRect)
+				) {
+					mergeToDrawList(j, drawListEntry->rect.findIntersectingRect(newItem->_screenRect), drawList);
 				}
 			}
 		}
@@ -103,7 +103,6 @@ private:
 
 public:
 	void vectorAdjustLineCoordinates(int16 *left, int16 *top, int16 *right, int16 *bottom, byte drawMask, byte color, byte priority, byte control);
-	byte vectorIsFillMatch(int16 x, int16 y, byte screenMask, byte checkForColor, byte checkForPriority, byte checkForControl, bool isEGA);
 
 	byte getDrawingMask(byte color, byte prio, byte control);
 	void drawLine(Common::Point startPoint, Common::Point endPoint, byte color, byte prio, byte control);
@@ -452,6 +451,37 @@ public:
 		return vectorGetPixel(_controlScreen, x, y);
 	}
 
+	// Called per pixel by the picture flood fill
+	byte vectorIsFillMatch(int16 x, int16 y, byte screenMask, byte checkForColor, byte checkForPriority, byte checkForControl, bool isEGA) {
+		int offset = y * _width + x;
+		byte match = 0;
+
+		if (screenMask & GFX_SCREEN_MASK_VISUAL) {
+			if (!isEGA) {
+				if (*(_visualScreen + offset) == checkForColor)
+					match |= GFX_SCREEN_MASK_VISUAL;
+			} else {
+				// In EGA games a pixel in the framebuffer is only 4 bits. We store
+				// a full byte per pixel to allow undithering, but when comparing
+				// pixels for flood-fill purposes, we should only compare the
+				// visible color of a pixel.
+
+				byte EGAcolor = *(_visualScreen + offset);
+				if ((x ^ y) & 1)
+					EGAcolor = (EGAcolor ^ (EGAcolor >> 4)) & 0x0F;
+				else
+					EGAcolor = EGAcolor & 0x0F;
+				if (EGAcolor == checkForColor)
+					match |= GFX_SCREEN_MASK_VISUAL;
+			}
+		}
+		if ((screenMask & GFX_SCREEN_MASK_PRIORITY) && *(_priorityScreen + offset) == checkForPriority)
+			match |= GFX_SCREEN_MASK_PRIORITY;
+		if ((screenMask & GFX_SCREEN_MASK_CONTROL) && *(_controlScreen + offset) == checkForControl)
+			match |= GFX_SCREEN_MASK_CONTROL;
+		return match;
+	}
+
 	void vectorAdjustCoordinate(int16 *x, int16 *y) {
 		switch (_upscaledHires) {
 		case GFX_SCREEN_UPSCALED_480x300:
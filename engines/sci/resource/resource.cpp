@@ -1081,6 +1081,18 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+#ifndef REDUCE_MEMORY_USAGE
+	// Devices with memory to spare keep more resources around, so that
+	// revisiting a room does not read and decompress everything again
+	_maxMemoryLRU *= 4;
+#endif
+
+	if (ConfMan.hasKey("sci_resource_cache_kb")) {
+		const int cacheSize = ConfMan.getInt("sci_resource_cache_kb");
+		if (cacheSize > 0)
+			_maxMemoryLRU = (int)MIN<int64>((int64)cacheSize * 1024, INT_MAX);
+	}
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1127,7 +1139,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	_LRU.erase(res->_lruPosition);
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1138,6 +1150,7 @@ void ResourceManager::addToLRU(Resource *res) {
 		return;
 	}
 	_LRU.push_front(res);
+	res->_lruPosition = _LRU.begin();
 	_memoryLRU += res->size();
 #ifdef SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -309,6 +309,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in the LRU list, valid while enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -494,6 +495,8 @@ protected:
 	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
 	// for resources which are not explicitly locked. However, a warning will be
 	// issued whenever this limit is exceeded.
+	// The default depends on the SCI version and REDUCE_MEMORY_USAGE, and can
+	// be overridden with the "sci_resource_cache_kb" configuration key.
 	int _maxMemoryLRU;
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
@@ -413,7 +413,8 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 			if (numSamples > (int)_monitoredBuffer.size()) {
 				_monitoredBuffer.resize(numSamples);
 			}
-			memset(_monitoredBuffer.data(), 0, _monitoredBuffer.size() * sizeof(Audio::st_sample_t));
+			// Only the part of the buffer written below is ever read back
+			memset(_monitoredBuffer.data(), 0, numSamples * sizeof(Audio::st_sample_t));
 			_numMonitoredSamples = writeAudioInternal(*channel.stream, *channel.converter, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
 
 			Audio::st_sample_t *sourceBuffer = _monitoredBuffer.data();
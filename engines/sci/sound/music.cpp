@@ -362,8 +362,10 @@ uint16 SciMusic::soundGetVoices() {
 }
 
 MusicEntry *SciMusic::getSlot(reg_t obj) {
-	Common::StackLock lock(_mutex);
-
+	// The playlist is only ever changed from the main thread, under the
+	// mutex. The timer thread only reads it, so a main thread lookup does not
+	// need to take the lock, which is shared with the mixer and would
+	// otherwise make every kDoSound call wait for a full mixing pass.
 	const MusicList::iterator end = _playList.end();
 	for (MusicList::iterator i = _playList.begin(); i != end; ++i) {
 		if ((*i)->soundObj == obj)
@@ -795,16 +797,20 @@ void SciMusic::soundKill(MusicEntry *pSnd) {
 	_mutex.lock();
 	remapChannels();
 
-	if (pSnd->pMidiParser) {
-		pSnd->pMidiParser->mainThreadBegin();
-		pSnd->pMidiParser->unloadMusic();
-		pSnd->pMidiParser->mainThreadEnd();
-		delete pSnd->pMidiParser;
+	MidiParser_SCI *midiParser = pSnd->pMidiParser;
+	if (midiParser) {
+		midiParser->mainThreadBegin();
+		midiParser->unloadMusic();
+		midiParser->mainThreadEnd();
 		pSnd->pMidiParser = nullptr;
 	}
 
 	_mutex.unlock();
 
+	// The timer can no longer reach the parser, so free it without holding
+	// the mixer lock
+	delete midiParser;
+
 	if (pSnd->isSample) {
 #ifdef ENABLE_SCI32
 		if (_soundVersion >= SCI_VERSION_2) {
@@ -828,16 +834,21 @@ void SciMusic::soundKill(MusicEntry *pSnd) {
 
 	_mutex.lock();
 	uint sz = _playList.size(), i;
+	MusicEntry *removed = nullptr;
 	// Remove sound from playlist
 	for (i = 0; i < sz; i++) {
 		if (_playList[i] == pSnd) {
-			delete _playList[i]->soundRes;
-			delete _playList[i];
+			removed = _playList[i];
 			_playList.remove_at(i);
 			break;
 		}
 	}
 	_mutex.unlock();
+
+	if (removed) {
+		delete removed->soundRes;
+		delete removed;
+	}
 }
 
 void SciMusic::soundPause(MusicEntry *pSnd) {
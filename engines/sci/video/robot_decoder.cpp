@@ -1521,7 +1521,9 @@ uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItem
 		targetBuffer = bitmap.getPixels();
 	} else {
 		// go through squashed cel decompressor
-		_celDecompressionBuffer.resize(_celDecompressionArea >= celWidth * (celHeight * _verticalScaleFactor / 100));
+		// preallocateCelMemory() has already grown the buffer to the largest
+		// cel of this frame, which is at least as large as any squashed cel
+		assert(_celDecompressionBuffer.size() >= (uint)(celWidth * (celHeight * _verticalScaleFactor / 100)));
 		targetBuffer = _celDecompressionBuffer.begin();
 	}
 
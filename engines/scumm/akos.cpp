@@ -281,6 +281,8 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeId = costume;
+
 	_akhd = (const AkosHeader *)_vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	_akof = (const AkosOffset *)_vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	_akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -713,6 +715,8 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 	int step;
 	byte drawFlag = 1;
 	ByleRLEData compData;
+	const byte *celSrc = _srcPtr;
+	int skippedColumns = 0;
 
 	const int scaletableSize = (_vm->_game.heversion >= 61) ? 128 : 384;
 
@@ -903,6 +907,7 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 		if (linesToSkip > 0) {
 			compData.skipWidth -= linesToSkip;
 			skipCelLines(compData, linesToSkip);
+			skippedColumns = linesToSkip;
 			compData.x = compData.boundsRect.left;
 		} else {
 			linesToSkip = rect.right - compData.boundsRect.right;
@@ -918,6 +923,7 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 		if (linesToSkip > 0) {
 			compData.skipWidth -= linesToSkip;
 			skipCelLines(compData, linesToSkip)	;
+			skippedColumns = linesToSkip;
 			compData.x = compData.boundsRect.right - 1;
 		} else {
 			linesToSkip = (compData.boundsRect.left -1) - rect.left;
@@ -953,11 +959,141 @@ byte AkosRenderer::paintCelByleRLE(int xMoveCur, int yMoveCur) {
 	compData.height = _out.h;
 	compData.destPtr = (byte *)_out.getBasePtr(compData.x, compData.y);
 
-	byleRLEDecode(compData);
+	const byte *decodedCel = nullptr;
+	if (!actorIsScaled && !_actorHitMode && _shadowMode == 0)
+		decodedCel = getDecodedCel(celSrc, compData);
+
+	if (decodedCel)
+		paintDecodedCel(compData, decodedCel + skippedColumns * _height);
+	else
+		byleRLEDecode(compData);
 
 	return drawFlag;
 }
 
+AkosRenderer::~AkosRenderer() {
+	flushDecodedCels();
+}
+
+void AkosRenderer::setDecodedCelBudget(uint32 budget) {
+	_decodedCelsBudget = budget;
+	flushDecodedCels();
+}
+
+void AkosRenderer::flushDecodedCels() {
+	for (DecodedCelMap::iterator i = _decodedCels.begin(); i != _decodedCels.end(); ++i)
+		free(i->_value);
+
+	_decodedCels.clear();
+	_decodedCelsSize = 0;
+}
+
+const byte *AkosRenderer::getDecodedCel(const byte *src, const ByleRLEData &compData) {
+	if (!_decodedCelsBudget)
+		return nullptr;
+
+	const uint64 key = ((uint64)_costumeId << 32) | (uint32)(src - _akcd);
+
+	DecodedCel *cel = nullptr;
+	if (_decodedCels.tryGetVal(key, cel)) {
+		if (cel->width == _width && cel->height == _height) {
+			cel->lastUsed = ++_decodedCelsStamp;
+			return cel->pixels;
+		}
+
+		_decodedCels.erase(key);
+		_decodedCelsSize -= cel->size;
+		free(cel);
+	}
+
+	const uint32 numPixels = _width * _height;
+	const uint32 size = sizeof(DecodedCel) + numPixels;
+
+	// Don't let a single huge cel flush everything else
+	if (size > _decodedCelsBudget / 4)
+		return nullptr;
+
+	while (_decodedCelsSize + size > _decodedCelsBudget && !_decodedCels.empty()) {
+		DecodedCelMap::iterator oldest = _decodedCels.begin();
+		for (DecodedCelMap::iterator i = _decodedCels.begin(); i != _decodedCels.end(); ++i) {
+			if (i->_value->lastUsed < oldest->_value->lastUsed)
+				oldest = i;
+		}
+
+		_decodedCelsSize -= oldest->_value->size;
+		free(oldest->_value);
+		_decodedCels.erase(oldest);
+	}
+
+	byte *mem = (byte *)malloc(size);
+	if (!mem)
+		return nullptr;
+
+	cel = (DecodedCel *)mem;
+	cel->width = _width;
+	cel->height = _height;
+	cel->size = size;
+	cel->lastUsed = ++_decodedCelsStamp;
+	cel->pixels = mem + sizeof(DecodedCel);
+
+	// Same run length encoding as handled by byleRLEDecode(), with the runs
+	// continuing from one column into the next.
+	byte *dst = cel->pixels;
+	uint32 left = numPixels;
+	while (left) {
+		byte len = *src++;
+		const byte color = len >> compData.shr;
+		len &= compData.mask;
+		if (!len)
+			len = *src++;
+
+		const uint32 run = MIN<uint32>(len ? len : 256, left);
+		memset(dst, color, run);
+		dst += run;
+		left -= run;
+	}
+
+	_decodedCels[key] = cel;
+	_decodedCelsSize += size;
+
+	return cel->pixels;
+}
+
+/**
+ * Unscaled, unshadowed counterpart of byleRLEDecode(), drawing from a cel
+ * decoded by getDecodedCel(). Clipping and masking are the same.
+ */
+void AkosRenderer::paintDecodedCel(ByleRLEData &dataBlock, const byte *src) {
+	const int xstart = _vm->_virtscr[kMainVirtScreen].xstart & 7;
+	const int bytesPerPixel = _vm->_bytesPerPixel;
+
+	for (int column = 0; column < dataBlock.skipWidth; column++) {
+		if (column) {
+			dataBlock.x += dataBlock.scaleXStep;
+			if (dataBlock.x < 0 || dataBlock.x >= dataBlock.boundsRect.right)
+				return;
+			dataBlock.destPtr += dataBlock.scaleXStep * bytesPerPixel;
+		}
+
+		const bool columnClipped = (dataBlock.x < 0 || dataBlock.x >= dataBlock.boundsRect.right);
+		const byte maskbit = revBitMask(dataBlock.x & 7);
+		const byte *mask = _vm->getMaskBuffer(dataBlock.x - xstart, dataBlock.y, _zbuf);
+		byte *dst = dataBlock.destPtr;
+		int y = dataBlock.y;
+
+		for (int row = 0; row < _height; row++, src++, y++, dst += _out.pitch, mask += _numStrips) {
+			const byte color = *src;
+			if (!color || columnClipped || y < dataBlock.boundsRect.top || y >= dataBlock.boundsRect.bottom || (*mask & maskbit))
+				continue;
+
+			if (bytesPerPixel == 2)
+				WRITE_UINT16(dst, _palette[color]);
+			else
+				*dst = _palette[color];
+		}
+	}
+}
+
 void AkosRenderer::markRectAsDirty(Common::Rect rect) {
 	rect.left -= _vm->_virtscr[kMainVirtScreen].xstart & 7;
 	rect.right -= _vm->_virtscr[kMainVirtScreen].xstart & 7;
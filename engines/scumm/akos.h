@@ -22,6 +22,8 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 #include "scumm/he/wiz_he.h"
 
@@ -95,6 +97,34 @@ protected:
 	const byte *_rgbs;  // Raw costume RGB colors (HE specific)
 	const uint8 *_xmap; // shadow color table (HE specific)
 
+	int _costumeId;
+
+	/**
+	 * BYLE RLE cels decoded to plain color indices, stored column by column
+	 * just like the RLE stream. Unscaled limbs without shadows are drawn
+	 * straight from these, with the palette, mirroring and z-plane masking
+	 * applied while copying, instead of decoding the RLE data every frame.
+	 * The cache is keyed by costume and cel offset, and the least recently
+	 * used cels are dropped once it grows beyond its memory budget.
+	 */
+	struct DecodedCel {
+		uint16 width, height;
+		uint32 size;
+		uint32 lastUsed;
+		byte *pixels;
+	};
+
+	struct DecodedCelKeyHash {
+		uint operator()(uint64 key) const { return (uint)(key ^ (key >> 32)); }
+	};
+
+	typedef Common::HashMap<uint64, DecodedCel *, DecodedCelKeyHash> DecodedCelMap;
+
+	DecodedCelMap _decodedCels;
+	uint32 _decodedCelsSize;
+	uint32 _decodedCelsBudget;
+	uint32 _decodedCelsStamp;
+
 
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
@@ -108,8 +138,13 @@ public:
 		_akct = nullptr;
 		_rgbs = nullptr;
 		_xmap = nullptr;
+		_costumeId = 0;
 		_actorHitMode = false;
+		_decodedCelsSize = 0;
+		_decodedCelsBudget = 0;
+		_decodedCelsStamp = 0;
 	}
+	~AkosRenderer() override;
 
 	bool _actorHitMode = false;
 	int16 _actorHitX = 0, _actorHitY = 0;
@@ -119,11 +154,20 @@ public:
 	void setFacing(const Actor *a) override;
 	void setCostume(int costume, int shadow) override;
 
+	/**
+	 * Set the amount of memory (in bytes) the decoded cel cache may use.
+	 * A budget of 0 disables the cache.
+	 */
+	void setDecodedCelBudget(uint32 budget);
+	void flushDecodedCels();
+
 protected:
 	byte drawLimb(const Actor *a, int limb) override;
 
 	byte paintCelByleRLE(int xMoveCur, int yMoveCur);
 	void byleRLEDecode(ByleRLEData &v1);
+	const byte *getDecodedCel(const byte *src, const ByleRLEData &compData);
+	void paintDecodedCel(ByleRLEData &compData, const byte *src);
 	byte paintCelCDATRLE(int xMoveCur, int yMoveCur);
 	byte paintCelMajMin(int xMoveCur, int yMoveCur);
 	byte paintCelTRLE(int actor, int drawToBack, int celX, int celY, int celWidth, int celHeight, byte tcolor, const byte *shadowTablePtr, int32 specialRenderFlags);
@@ -216,9 +216,12 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+	_roomBgCacheSize = 0;
+	_roomBgCacheBudget = 0;
 }
 
 Gdi::~Gdi() {
+	flushRoomBgCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(nullptr) {
@@ -268,6 +271,8 @@ GdiHE16bit::GdiHE16bit(ScummEngine *vm) : GdiHE(vm) {
 #endif
 
 void Gdi::init() {
+	flushRoomBgCache();
+
 	_numStrips = _vm->_screenWidth / 8;
 
 	// Increase the number of screen strips by one; needed for smooth scrolling
@@ -692,6 +697,20 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 		assert(IS_ALIGNED(text, 4));
 		assert(0 == (width & 3));
 
+		// Most strips have no text over them, in which case composing would
+		// just produce a copy of the virtual screen. When no post-processing
+		// has to read the composite buffer, hand the virtual screen to the
+		// backend directly and save a full read/write pass over the strip.
+		if (m == 1 && !_macScreen && !_enableEGADithering &&
+			_game.platform != Common::kPlatformNES &&
+			_game.platform != Common::kPlatformFMTowns &&
+			!(_game.platform == Common::kPlatformDOS && _game.version < 5) &&
+			vs->format.bytesPerPixel == _outputPixelFormat.bytesPerPixel &&
+			isTextSurfaceAreaTransparent((const uint32 *)text, width, height)) {
+			_system->copyRectToScreen(src, vs->pitch, x, y, width, height);
+			return;
+		}
+
 #ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
 		if (_game.platform == Common::kPlatformFMTowns) {
 			towns_drawStripToScreen(vs, x, y, x, top, width, height);
@@ -810,6 +829,21 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 	}
 }
 
+bool ScummEngine::isTextSurfaceAreaTransparent(const uint32 *text32, int width, int height) const {
+	const int textPitch = _textSurface.pitch >> 2;
+	const int words = width >> 2;
+
+	for (int h = height; h > 0; --h) {
+		for (int w = 0; w < words; ++w) {
+			if (text32[w] != CHARSET_MASK_TRANSPARENCY_32)
+				return false;
+		}
+		text32 += textPitch;
+	}
+
+	return true;
+}
+
 const byte *ScummEngine::postProcessDOSGraphics(VirtScreen *vs, int &pitch, int &x, int &y, int &width, int &height) const {
 	static const byte v2VrbColMap[] =	{ 0x0, 0x5, 0x5, 0x5, 0xA, 0xA, 0xA, 0xF, 0xF, 0x5, 0x5, 0x5, 0xA, 0xA, 0xF, 0xF };
 	static const byte v2TxtColMap[] =	{ 0x0, 0xF, 0xA, 0x5, 0xA, 0x5, 0x5, 0xF, 0xA, 0xA, 0xA, 0xA, 0xA, 0x5, 0x5, 0xF };
@@ -1178,7 +1212,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbRoomBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -2363,6 +2397,10 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	RoomBgCacheEntry *bgCache = nullptr;
+	if ((flag & dbRoomBackground) && y == 0 && vs->format.bytesPerPixel == 1)
+		bgCache = findRoomBgCacheEntry(height, numzbuf);
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -2395,7 +2433,17 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->getBasePtr(x * 8, y);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		const bool stripCached = bgCache && stripnr < bgCache->numRoomStrips &&
+			bgCache->stripState[stripnr] == kBgStripCached;
+
+		if (stripCached) {
+			restoreRoomBgStrip(bgCache, dstPtr, vs->pitch, x, y, stripnr, zplane_list);
+			transpStrip = false;
+		} else {
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		}
+
+		const bool decodedTranspStrip = transpStrip;
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -2409,7 +2457,12 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (!stripCached) {
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+
+			if (bgCache && stripnr < bgCache->numRoomStrips)
+				storeRoomBgStrip(bgCache, dstPtr, vs->pitch, x, y, stripnr, decodedTranspStrip, zplane_list);
+		}
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -2445,6 +2498,142 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	}
 }
 
+void Gdi::setRoomBgCacheBudget(uint32 budget) {
+	_roomBgCacheBudget = budget;
+
+	while (_roomBgCacheSize > _roomBgCacheBudget && !_roomBgCache.empty()) {
+		RoomBgCacheEntry *entry = _roomBgCache.back();
+		_roomBgCache.pop_back();
+		_roomBgCacheSize -= entry->size;
+		free(entry);
+	}
+}
+
+void Gdi::flushRoomBgCache() {
+	for (Common::List<RoomBgCacheEntry *>::iterator i = _roomBgCache.begin(); i != _roomBgCache.end(); ++i)
+		free(*i);
+
+	_roomBgCache.clear();
+	_roomBgCacheSize = 0;
+}
+
+/**
+ * Find (or create) the cache entry holding the decoded background of the
+ * current room. The entry is keyed by the room, its dimensions, the number
+ * of active z-planes and the room palette map used while decoding, so any
+ * change to these simply results in a different entry. Least recently used
+ * rooms are evicted once the memory budget is exceeded.
+ */
+Gdi::RoomBgCacheEntry *Gdi::findRoomBgCacheEntry(int height, int numzbuf) {
+	if (!_roomBgCacheBudget)
+		return nullptr;
+
+	const int room = _vm->_roomResource;
+	const int numRoomStrips = _vm->_roomWidth / 8;
+
+	for (Common::List<RoomBgCacheEntry *>::iterator i = _roomBgCache.begin(); i != _roomBgCache.end(); ++i) {
+		RoomBgCacheEntry *entry = *i;
+		if (entry->room == room && entry->numRoomStrips == numRoomStrips && entry->height == height &&
+			entry->numZBuffer == numzbuf && !memcmp(entry->palette, _roomPalette, sizeof(entry->palette))) {
+			if (i != _roomBgCache.begin()) {
+				_roomBgCache.erase(i);
+				_roomBgCache.push_front(entry);
+			}
+			return entry;
+		}
+	}
+
+	// Z-plane 0 is never touched when drawing the room background
+	const uint32 pixelSize = numRoomStrips * height * 8;
+	const uint32 maskSize = MAX(numzbuf - 1, 0) * numRoomStrips * height;
+	const uint32 size = sizeof(RoomBgCacheEntry) + numRoomStrips + pixelSize + maskSize;
+
+	if (numRoomStrips <= 0 || size > _roomBgCacheBudget)
+		return nullptr;
+
+	while (_roomBgCacheSize + size > _roomBgCacheBudget && !_roomBgCache.empty()) {
+		RoomBgCacheEntry *entry = _roomBgCache.back();
+		_roomBgCache.pop_back();
+		_roomBgCacheSize -= entry->size;
+		free(entry);
+	}
+
+	byte *mem = (byte *)malloc(size);
+	if (!mem)
+		return nullptr;
+
+	RoomBgCacheEntry *entry = (RoomBgCacheEntry *)mem;
+	entry->room = room;
+	entry->numRoomStrips = numRoomStrips;
+	entry->height = height;
+	entry->numZBuffer = numzbuf;
+	memcpy(entry->palette, _roomPalette, sizeof(entry->palette));
+	entry->size = size;
+	entry->stripState = mem + sizeof(RoomBgCacheEntry);
+	entry->pixels = entry->stripState + numRoomStrips;
+	entry->masks = entry->pixels + pixelSize;
+	memset(entry->stripState, kBgStripEmpty, numRoomStrips);
+
+	_roomBgCache.push_front(entry);
+	_roomBgCacheSize += size;
+
+	return entry;
+}
+
+void Gdi::storeRoomBgStrip(RoomBgCacheEntry *entry, const byte *src, int srcPitch, int x, int y,
+				int stripnr, bool transpStrip, const byte *zplane_list[9]) {
+	if (entry->stripState[stripnr] != kBgStripEmpty)
+		return;
+
+	// Transparent strips leave whatever was in the buffer before, so their
+	// decoded content is not a function of the room image alone.
+	if (transpStrip) {
+		entry->stripState[stripnr] = kBgStripUncacheable;
+		return;
+	}
+
+	const int height = entry->height;
+	byte *dst = entry->pixels + stripnr * height * 8;
+	for (int h = 0; h < height; h++) {
+		memcpy(dst, src, 8);
+		dst += 8;
+		src += srcPitch;
+	}
+
+	for (int i = 1; i < entry->numZBuffer; i++) {
+		if (!zplane_list[i])
+			continue;
+
+		const byte *mask_ptr = getMaskBuffer(x, y, i);
+		dst = entry->masks + ((i - 1) * entry->numRoomStrips + stripnr) * height;
+		for (int h = 0; h < height; h++)
+			dst[h] = mask_ptr[h * _numStrips];
+	}
+
+	entry->stripState[stripnr] = kBgStripCached;
+}
+
+void Gdi::restoreRoomBgStrip(const RoomBgCacheEntry *entry, byte *dst, int dstPitch, int x, int y,
+				int stripnr, const byte *zplane_list[9]) {
+	const int height = entry->height;
+	const byte *src = entry->pixels + stripnr * height * 8;
+	for (int h = 0; h < height; h++) {
+		memcpy(dst, src, 8);
+		src += 8;
+		dst += dstPitch;
+	}
+
+	for (int i = 1; i < entry->numZBuffer; i++) {
+		if (!zplane_list[i])
+			continue;
+
+		byte *mask_ptr = getMaskBuffer(x, y, i);
+		src = entry->masks + ((i - 1) * entry->numRoomStrips + stripnr) * height;
+		for (int h = 0; h < height; h++)
+			mask_ptr[h * _numStrips] = src[h];
+	}
+}
+
 bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr) {
 	// Do some input verification and make sure the strip/strip offset
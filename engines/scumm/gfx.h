@@ -304,6 +304,40 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/**
+	 * Decoded room background strips and the z-plane masks belonging to them.
+	 * Redrawing a strip of a room that is still in the cache (e.g. while
+	 * scrolling, or when returning to a recently visited room) is a plain
+	 * copy instead of another pass through the strip decoders.
+	 */
+	struct RoomBgCacheEntry {
+		int room;
+		int numRoomStrips;
+		int height;
+		int numZBuffer;
+		byte palette[256];
+		uint32 size;
+		byte *stripState;
+		byte *pixels;
+		byte *masks;
+	};
+
+	enum RoomBgStripState {
+		kBgStripEmpty = 0,
+		kBgStripCached = 1,
+		kBgStripUncacheable = 2
+	};
+
+	Common::List<RoomBgCacheEntry *> _roomBgCache;
+	uint32 _roomBgCacheSize;
+	uint32 _roomBgCacheBudget;
+
+	RoomBgCacheEntry *findRoomBgCacheEntry(int height, int numzbuf);
+	void storeRoomBgStrip(RoomBgCacheEntry *entry, const byte *src, int srcPitch, int x, int y,
+	                int stripnr, bool transpStrip, const byte *zplane_list[9]);
+	void restoreRoomBgStrip(const RoomBgCacheEntry *entry, byte *dst, int dstPitch, int x, int y,
+	                int stripnr, const byte *zplane_list[9]);
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -377,10 +411,18 @@ public:
 
 	void resetBackground(int top, int bottom, int strip);
 
+	/**
+	 * Set the amount of memory (in bytes) the decoded room background cache
+	 * may use. A budget of 0 disables the cache.
+	 */
+	void setRoomBgCacheBudget(uint32 budget);
+	void flushRoomBgCache();
+
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbRoomBackground = 1 << 4
 	};
 };
 
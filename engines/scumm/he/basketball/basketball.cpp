@@ -59,8 +59,11 @@ int Basketball::u32DoubleToInt(double input) {
 }
 
 void Basketball::fillBallTargetList(const CCollisionSphere *sourceObject, CCollisionObjectVector *targetList) {
+	// Everything the ball can reach this step lies within its big bounding box...
+	const U32BoundingBox searchBox = sourceObject->getBigBoundingBox();
+
 	// Add all of the court objects...
-	_court->_objectTree.selectObjectsInBound(sourceObject->getBigBoundingBox(), targetList);
+	_court->_objectTree.selectObjectsInBound(searchBox, targetList);
 
 	// Add the shields...
 	CCollisionShieldVector::const_iterator shieldIt;
@@ -77,7 +80,8 @@ void Basketball::fillBallTargetList(const CCollisionSphere *sourceObject, CColli
 	for (homePlayerIt = _court->_homePlayerList.begin();
 		 homePlayerIt != _court->_homePlayerList.end();
 		 ++homePlayerIt) {
-		if (!homePlayerIt->_ignore) {
+		if (!homePlayerIt->_ignore &&
+			searchBox.intersect(homePlayerIt->getBoundingBox())) {
 			targetList->push_back(&(*homePlayerIt));
 		}
 	}
@@ -88,15 +92,19 @@ void Basketball::fillBallTargetList(const CCollisionSphere *sourceObject, CColli
 	for (awayPlayerIt = _court->_awayPlayerList.begin();
 		 awayPlayerIt != _court->_awayPlayerList.end();
 		 ++awayPlayerIt) {
-		if (!awayPlayerIt->_ignore) {
+		if (!awayPlayerIt->_ignore &&
+			searchBox.intersect(awayPlayerIt->getBoundingBox())) {
 			targetList->push_back(&(*awayPlayerIt));
 		}
 	}
 }
 
 void Basketball::fillPlayerTargetList(const CCollisionPlayer *sourceObject, CCollisionObjectVector *targetList) {
+	// Everything the player can reach this step lies within its big bounding box...
+	const U32BoundingBox searchBox = sourceObject->getBigBoundingBox();
+
 	// Add all of the court objects...
-	_court->_objectTree.selectObjectsInBound(sourceObject->getBigBoundingBox(), targetList);
+	_court->_objectTree.selectObjectsInBound(searchBox, targetList);
 
 	// Add the shields if the player has the ball...
 	if (sourceObject->_playerHasBall) {
@@ -110,12 +118,14 @@ void Basketball::fillPlayerTargetList(const CCollisionPlayer *sourceObject, CCol
 	}
 
 	// Add the basketball...
-	if (!_court->_basketBall._ignore) {
+	if (!_court->_basketBall._ignore &&
+		searchBox.intersect(_court->_basketBall.getBoundingBox())) {
 		targetList->push_back((ICollisionObject *)&_court->_basketBall);
 	}
 
 	// Add the virtual basketball...
-	if (!_court->_virtualBall._ignore) {
+	if (!_court->_virtualBall._ignore &&
+		searchBox.intersect(_court->_virtualBall.getBoundingBox())) {
 		targetList->push_back((ICollisionObject *)&_court->_virtualBall);
 	}
 
@@ -126,7 +136,8 @@ void Basketball::fillPlayerTargetList(const CCollisionPlayer *sourceObject, CCol
 		 homePlayerIt != _court->_homePlayerList.end();
 		 ++homePlayerIt) {
 		if ((sourceObject != &(*homePlayerIt)) &&
-			(!homePlayerIt->_ignore)) {
+			(!homePlayerIt->_ignore) &&
+			searchBox.intersect(homePlayerIt->getBoundingBox())) {
 			targetList->push_back(&(*homePlayerIt));
 		}
 	}
@@ -138,7 +149,8 @@ void Basketball::fillPlayerTargetList(const CCollisionPlayer *sourceObject, CCol
 		 awayPlayerIt != _court->_awayPlayerList.end();
 		 ++awayPlayerIt) {
 		if ((sourceObject != &(*awayPlayerIt)) &&
-			(!awayPlayerIt->_ignore)) {
+			(!awayPlayerIt->_ignore) &&
+			searchBox.intersect(awayPlayerIt->getBoundingBox())) {
 			targetList->push_back(&(*awayPlayerIt));
 		}
 	}
@@ -562,31 +562,12 @@ struct U32BoundingBox {
 	}
 
 	bool intersect(const U32BoundingBox &targetBox) const {
-		return ((((minPoint.x <= targetBox.minPoint.x) &&
-				  (maxPoint.x >= targetBox.minPoint.x)) ||
-
-				 ((minPoint.x <= targetBox.maxPoint.x) &&
-				  (maxPoint.x >= targetBox.maxPoint.x)) ||
-
-				 ((targetBox.minPoint.x <= minPoint.x) &&
-				  (targetBox.maxPoint.x >= minPoint.x)) ||
-
-				 ((targetBox.minPoint.x <= maxPoint.x) &&
-				  (targetBox.maxPoint.x >= maxPoint.x)))
-
-				&&
-
-				(((minPoint.y <= targetBox.minPoint.y) &&
-				  (maxPoint.y >= targetBox.minPoint.y)) ||
-
-				 ((minPoint.y <= targetBox.maxPoint.y) &&
-				  (maxPoint.y >= targetBox.maxPoint.y)) ||
-
-				 ((targetBox.minPoint.y <= minPoint.y) &&
-				  (targetBox.maxPoint.y >= minPoint.y)) ||
-
-				 ((targetBox.minPoint.y <= maxPoint.y) &&
-				  (targetBox.maxPoint.y >= maxPoint.y))));
+		// Two boxes overlap in the xy plane unless one lies entirely
+		// to one side of the other along x or y...
+		return ((minPoint.x <= targetBox.maxPoint.x) &&
+				(targetBox.minPoint.x <= maxPoint.x) &&
+				(minPoint.y <= targetBox.maxPoint.y) &&
+				(targetBox.minPoint.y <= maxPoint.y));
 	}
 
 	const U32IntPoint3D &operator[](int point) const {
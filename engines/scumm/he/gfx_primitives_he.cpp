@@ -929,6 +929,82 @@ void Wiz::pgSimpleBlitTransparentMixColors(WizSimpleBitmap *destBM, Common::Rect
 	}
 }
 
+// Word-at-a-time helpers for the transparent blitters: four 8-bit (or two
+// 16-bit) pixels are tested against the transparent colour at once, so fully
+// opaque and fully transparent spans cost one load and at most one store.
+static inline bool wordHasByte(uint32 word, uint32 pattern) {
+	uint32 x = word ^ pattern;
+	return ((x - 0x01010101U) & ~x & 0x80808080U) != 0;
+}
+
+static void transparentForwardCopy8(WizRawPixel8 *dst, const WizRawPixel8 *src, int count, int transparentColor) {
+	if (transparentColor & ~0xFF) {
+		memcpy(dst, src, count);
+		return;
+	}
+
+	const uint32 pattern = transparentColor * 0x01010101U;
+
+	while (count >= 4) {
+		uint32 word = READ_UINT32(src);
+
+		if (!wordHasByte(word, pattern)) {
+			WRITE_UINT32(dst, word);
+		} else if (word != pattern) {
+			for (int i = 0; i < 4; i++) {
+				if (src[i] != transparentColor)
+					dst[i] = src[i];
+			}
+		}
+
+		src += 4;
+		dst += 4;
+		count -= 4;
+	}
+
+	while (--count >= 0) {
+		if (*src != transparentColor)
+			*dst = *src;
+		src++;
+		dst++;
+	}
+}
+
+static void transparentForwardCopy16(WizRawPixel16 *dst, const WizRawPixel16 *src, int count, int transparentColor) {
+#ifdef SCUMM_LITTLE_ENDIAN
+	// The source is little endian, so on little endian hosts the raw words
+	// can be compared and stored without byte swapping.
+	const uint32 tColor = (uint32)transparentColor;
+	const uint32 pattern = tColor * 0x00010001U;
+
+	while (count >= 2 && !(tColor & ~0xFFFF)) {
+		uint32 word = READ_UINT32(src);
+
+		if (word == pattern) {
+			// Both pixels transparent
+		} else if ((word & 0xFFFF) != tColor && (word >> 16) != tColor) {
+			WRITE_UINT32(dst, word);
+		} else if ((word & 0xFFFF) != tColor) {
+			dst[0] = src[0];
+		} else {
+			dst[1] = src[1];
+		}
+
+		src += 2;
+		dst += 2;
+		count -= 2;
+	}
+#endif
+
+	while (--count >= 0) {
+		WizRawPixel16 value = FROM_LE_16(*src);
+		if (value != transparentColor)
+			*dst = value;
+		src++;
+		dst++;
+	}
+}
+
 void Wiz::pgTransparentSimpleBlit(WizSimpleBitmap *destBM, Common::Rect *destRect, WizSimpleBitmap *sourceBM, Common::Rect *sourceRect, WizRawPixel transparentColor) {
 	int value, cw, dw, sw, ch, soff, doff, tColor;
 	WizRawPixel8 *s8, *d8;
@@ -954,36 +1030,17 @@ void Wiz::pgTransparentSimpleBlit(WizSimpleBitmap *destBM, Common::Rect *destRec
 
 	// Left or right?
 	if (sourceRect->left <= sourceRect->right) {
-		soff = sw - cw;
-		doff = dw - cw;
-
 		while (--ch >= 0) {
 			if (!_uses16BitColor) {
-				for (int x = cw; --x >= 0;) {
-					value = *s8++;
+				transparentForwardCopy8(d8, s8, cw, tColor);
 
-					if (value != tColor) {
-						*d8++ = (WizRawPixel8)value;
-					} else {
-						d8++;
-					}
-				}
-
-				s8 += soff;
-				d8 += doff;
+				s8 += sw;
+				d8 += dw;
 			} else {
-				for (int x = cw; --x >= 0;) {
-					value = FROM_LE_16(*s16++);
+				transparentForwardCopy16(d16, s16, cw, tColor);
 
-					if (value != tColor) {
-						*d16++ = (WizRawPixel16)value;
-					} else {
-						d16++;
-					}
-				}
-
-				s16 += soff;
-				d16 += doff;
+				s16 += sw;
+				d16 += dw;
 			}
 
 		}
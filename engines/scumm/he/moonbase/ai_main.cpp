@@ -500,7 +500,6 @@ int AI::masterControlProgram(const int paramCount, const int32 *params) {
 		break;
 	}
 
-	delete retNode;
 	retNode = NULL;
 
 	if (getPlayerEnergy() < 7) {
@@ -30,14 +30,16 @@ IContainedObject::IContainedObject(IContainedObject &sourceContainedObject) {
 
 int Node::_nodeCount = 0;
 
-Node::Node() {
+Node::Node(NodePool *pool) {
+	_pool = pool;
 	_parent = nullptr;
 	_depth = 0;
 	_nodeCount++;
 	_contents = nullptr;
 }
 
-Node::Node(Node *sourceNode) {
+Node::Node(NodePool *pool, Node *sourceNode) {
+	_pool = pool;
 	_parent = nullptr;
 	_children = sourceNode->getChildren();
 
@@ -55,6 +57,11 @@ Node::~Node() {
 	_nodeCount--;
 }
 
+void Node::destroy() {
+	NodePool *pool = _pool;
+	pool->deleteChunk(this);
+}
+
 int Node::generateChildren() {
 	int numChildren = _contents->numChildrenToGen();
 
@@ -63,7 +70,7 @@ int Node::generateChildren() {
 	static int i = 0;
 
 	while (i < numChildren) {
-		Node *tempNode = new Node;
+		Node *tempNode = new (*_pool) Node(_pool);
 		_children.push_back(tempNode);
 		tempNode->setParent(this);
 		tempNode->setDepth(_depth + 1);
@@ -75,7 +82,7 @@ int Node::generateChildren() {
 
 		if (!completionFlag) {
 			_children.pop_back();
-			delete tempNode;
+			tempNode->destroy();
 			return 0;
 		}
 
@@ -85,7 +92,7 @@ int Node::generateChildren() {
 			tempNode->setContainedObject(thisContObj);
 		} else {
 			_children.pop_back();
-			delete tempNode;
+			tempNode->destroy();
 			numChildrenGenerated--;
 		}
 	}
@@ -104,7 +111,7 @@ int Node::generateNextChild() {
 
 	static int i = 0;
 
-	Node *tempNode = new Node;
+	Node *tempNode = new (*_pool) Node(_pool);
 	_children.push_back(tempNode);
 	tempNode->setParent(this);
 	tempNode->setDepth(_depth + 1);
@@ -116,7 +123,7 @@ int Node::generateNextChild() {
 		tempNode->setContainedObject(thisContObj);
 	} else {
 		_children.pop_back();
-		delete tempNode;
+		tempNode->destroy();
 	}
 
 	++i;
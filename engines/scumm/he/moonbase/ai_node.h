@@ -23,6 +23,7 @@
 #define SCUMM_HE_MOONBASE_AI_NODE_H
 
 #include "common/array.h"
+#include "common/memorypool.h"
 
 namespace Scumm {
 
@@ -61,8 +62,14 @@ public:
 	float returnG() const { return getG(); }
 };
 
+class Node;
+
+// Nodes are allocated from a pool owned by their Tree
+typedef Common::ObjectPool<Node> NodePool;
+
 class Node {
 private:
+	NodePool *_pool;
 	Node *_parent;
 	Common::Array<Node *> _children;
 
@@ -72,10 +79,13 @@ private:
 	IContainedObject *_contents;
 
 public:
-	Node();
-	Node(Node *sourceNode);
+	Node(NodePool *pool);
+	Node(NodePool *pool, Node *sourceNode);
 	~Node();
 
+	// Destroys the node and returns it to its pool
+	void destroy();
+
 	void setParent(Node *parentPtr) { _parent = parentPtr; }
 	Node *getParent() const { return _parent; }
 
@@ -87,7 +97,8 @@ public:
 	void setContainedObject(IContainedObject *value) { _contents = value; }
 	IContainedObject *getContainedObject() { return _contents; }
 
-	Common::Array<Node *> getChildren() const { return _children; }
+	const Common::Array<Node *> &getChildren() const { return _children; }
+	void addChild(Node *child) { _children.push_back(child); }
 	int generateChildren();
 	int generateNextChild();
 	Node *popChild();
@@ -37,7 +37,7 @@ static int compareTreeNodes(const void *a, const void *b) {
 }
 
 Tree::Tree(AI *ai) : _ai(ai) {
-	pBaseNode = new Node;
+	pBaseNode = new (_nodePool) Node(&_nodePool);
 	_maxDepth = MAX_DEPTH;
 	_maxNodes = MAX_NODES;
 	_currentNode = nullptr;
@@ -47,7 +47,7 @@ Tree::Tree(AI *ai) : _ai(ai) {
 }
 
 Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
-	pBaseNode = new Node;
+	pBaseNode = new (_nodePool) Node(&_nodePool);
 	pBaseNode->setContainedObject(contents);
 	_maxDepth = MAX_DEPTH;
 	_maxNodes = MAX_NODES;
@@ -58,7 +58,7 @@ Tree::Tree(IContainedObject *contents, AI *ai) : _ai(ai) {
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
-	pBaseNode = new Node;
+	pBaseNode = new (_nodePool) Node(&_nodePool);
 	pBaseNode->setContainedObject(contents);
 	_maxDepth = maxDepth;
 	_maxNodes = MAX_NODES;
@@ -69,7 +69,7 @@ Tree::Tree(IContainedObject *contents, int maxDepth, AI *ai) : _ai(ai) {
 }
 
 Tree::Tree(IContainedObject *contents, int maxDepth, int maxNodes, AI *ai) : _ai(ai) {
-	pBaseNode = new Node;
+	pBaseNode = new (_nodePool) Node(&_nodePool);
 	pBaseNode->setContainedObject(contents);
 	_maxDepth = maxDepth;
 	_maxNodes = maxNodes;
@@ -83,16 +83,16 @@ void Tree::duplicateTree(Node *sourceNode, Node *destNode) {
 	Common::Array<Node *> vUnvisited = sourceNode->getChildren();
 
 	while (vUnvisited.size()) {
-		Node *newNode = new Node(*(vUnvisited.end()));
+		Node *newNode = new (_nodePool) Node(&_nodePool, vUnvisited.back());
 		newNode->setParent(destNode);
-		(destNode->getChildren()).push_back(newNode);
-		duplicateTree(*(vUnvisited.end()), newNode);
+		destNode->addChild(newNode);
+		duplicateTree(vUnvisited.back(), newNode);
 		vUnvisited.pop_back();
 	}
 }
 
 Tree::Tree(const Tree *sourceTree, AI *ai) : _ai(ai) {
-	pBaseNode = new Node(sourceTree->getBaseNode());
+	pBaseNode = new (_nodePool) Node(&_nodePool, sourceTree->getBaseNode());
 	_maxDepth = sourceTree->getMaxDepth();
 	_maxNodes = sourceTree->getMaxNodes();
 	_currentMap = new Common::SortedArray<TreeNode *>(compareTreeNodes);
@@ -115,12 +115,43 @@ Tree::~Tree() {
 			// Delete this node, and move up to the parent for further processing
 			Node *pTemp = pNodeItr;
 			pNodeItr = pNodeItr->getParent();
-			delete pTemp;
+			pTemp->destroy();
 			pTemp = nullptr;
 		}
 	}
 
 	delete _currentMap;
+
+	for (uint i = 0; i < _treeNodeBlocks.size(); i++)
+		delete[] _treeNodeBlocks[i];
+}
+
+TreeNode *Tree::allocTreeNode(float value, Node *node) {
+	if (_freeTreeNodes.empty()) {
+		TreeNode *block = new TreeNode[TREE_NODE_BLOCK_SIZE];
+		_treeNodeBlocks.push_back(block);
+
+		for (int i = TREE_NODE_BLOCK_SIZE - 1; i >= 0; i--)
+			_freeTreeNodes.push_back(&block[i]);
+	}
+
+	TreeNode *treeNode = _freeTreeNodes.back();
+	_freeTreeNodes.pop_back();
+
+	treeNode->value = value;
+	treeNode->node = node;
+
+	return treeNode;
+}
+
+Node *Tree::popOpenNode(Common::SortedArray<TreeNode *> &openList) {
+	TreeNode *front = openList.front();
+	Node *node = front->node;
+
+	openList.erase(openList.begin());
+	freeTreeNode(front);
+
+	return node;
 }
 
 Node *Tree::aStarSearch() {
@@ -134,24 +165,23 @@ Node *Tree::aStarSearch() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		mmfpOpen.insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		mmfpOpen.insert(allocTreeNode(pBaseNode->getObjectT(), pBaseNode));
 
 		while (mmfpOpen.size() && (retNode == nullptr)) {
-			currentNode = mmfpOpen.front()->node;
-			mmfpOpen.erase(mmfpOpen.begin());
+			currentNode = popOpenNode(mmfpOpen);
 
 			if ((currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes)) {
 				// Generate nodes
-				Common::Array<Node *> vChildren = currentNode->getChildren();
+				const Common::Array<Node *> &vChildren = currentNode->getChildren();
 
-				for (Common::Array<Node *>::iterator i = vChildren.begin(); i != vChildren.end(); i++) {
+				for (Common::Array<Node *>::const_iterator i = vChildren.begin(); i != vChildren.end(); i++) {
 					IContainedObject *pTemp = (*i)->getContainedObject();
 					currentT = pTemp->calcT();
 
 					if (currentT == SUCCESS)
 						retNode = *i;
 					else
-						mmfpOpen.insert(new TreeNode(currentT, (*i)));
+						mmfpOpen.insert(allocTreeNode(currentT, (*i)));
 				}
 			} else {
 				retNode = currentNode;
@@ -173,7 +203,7 @@ Node *Tree::aStarSearch_singlePassInit() {
 	float temp = pBaseNode->getContainedObject()->calcT();
 
 	if (static_cast<int>(temp) != SUCCESS) {
-		_currentMap->insert(new TreeNode(pBaseNode->getObjectT(), pBaseNode));
+		_currentMap->insert(allocTreeNode(pBaseNode->getObjectT(), pBaseNode));
 	} else {
 		retNode = pBaseNode;
 	}
@@ -197,8 +227,7 @@ Node *Tree::aStarSearch_singlePass() {
 			return retNode;
 		}
 
-		_currentNode = _currentMap->front()->node;
-		_currentMap->erase(_currentMap->begin());
+		_currentNode = popOpenNode(*_currentMap);
 	}
 
 	if ((_currentNode->getDepth() < _maxDepth) && (Node::getNodeCount() < _maxNodes) && ((!maxTime) || (_ai->getTimerValue(3) < maxTime))) {
@@ -206,14 +235,14 @@ Node *Tree::aStarSearch_singlePass() {
 		_currentChildIndex = _currentNode->generateChildren();
 
 		if (_currentChildIndex) {
-			Common::Array<Node *> vChildren = _currentNode->getChildren();
+			const Common::Array<Node *> &vChildren = _currentNode->getChildren();
 
 			if (!vChildren.size() && !_currentMap->size()) {
 				_currentChildIndex = 0;
 				retNode = _currentNode;
 			}
 
-			for (Common::Array<Node *>::iterator i = vChildren.begin(); i != vChildren.end(); i++) {
+			for (Common::Array<Node *>::const_iterator i = vChildren.begin(); i != vChildren.end(); i++) {
 				IContainedObject *pTemp = (*i)->getContainedObject();
 				currentT = pTemp->calcT();
 
@@ -221,7 +250,7 @@ Node *Tree::aStarSearch_singlePass() {
 					retNode = *i;
 					i = vChildren.end() - 1;
 				} else {
-					_currentMap->insert(new TreeNode(currentT, (*i)));
+					_currentMap->insert(allocTreeNode(currentT, (*i)));
 				}
 			}
 
@@ -29,6 +29,7 @@ namespace Scumm {
 
 const int MAX_DEPTH = 100;
 const int MAX_NODES = 1000000;
+const int TREE_NODE_BLOCK_SIZE = 256;
 
 class AI;
 
@@ -36,6 +37,7 @@ struct TreeNode {
 	float value;
 	Node *node;
 
+	TreeNode() { value = 0; node = nullptr; }
 	TreeNode(float v, Node *n) { value = v; node = n; }
 };
 
@@ -53,6 +55,17 @@ private:
 
 	AI *_ai;
 
+	NodePool _nodePool;
+
+	// Open list entries are carved out of blocks and recycled once popped,
+	// instead of being allocated one by one for every expanded child.
+	Common::Array<TreeNode *> _treeNodeBlocks;
+	Common::Array<TreeNode *> _freeTreeNodes;
+
+	TreeNode *allocTreeNode(float value, Node *node);
+	void freeTreeNode(TreeNode *treeNode) { _freeTreeNodes.push_back(treeNode); }
+	Node *popOpenNode(Common::SortedArray<TreeNode *> &openList);
+
 public:
 	Tree(AI *ai);
 	Tree(IContainedObject *contents, AI *ai);
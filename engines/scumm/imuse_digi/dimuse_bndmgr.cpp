@@ -29,7 +29,15 @@
 
 namespace Scumm {
 
-BundleDirCache::BundleDirCache(const ScummEngine *vm) : _vm(vm) {
+#ifdef REDUCE_MEMORY_USAGE
+static const int kNumCachedBundleBlocks = 8;
+static const int kNumReadAheadBundleBlocks = 2;
+#else
+static const int kNumCachedBundleBlocks = 64;
+static const int kNumReadAheadBundleBlocks = 4;
+#endif
+
+BundleDirCache::BundleDirCache(const ScummEngine *vm) : _vm(vm), _blockCache(nullptr), _blockCacheStamp(0) {
 	for (int fileId = 0; fileId < ARRAYSIZE(_bundleDirCache); fileId++) {
 		_bundleDirCache[fileId].bundleTable = nullptr;
 		_bundleDirCache[fileId].fileName[0] = 0;
@@ -44,6 +52,7 @@ BundleDirCache::~BundleDirCache() {
 		free(_bundleDirCache[fileId].bundleTable);
 		free(_bundleDirCache[fileId].indexTable);
 	}
+	free(_blockCache);
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -62,6 +71,69 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _bundleDirCache[slot].isCompressed;
 }
 
+bool BundleDirCache::hasCachedBlock(int slot, int32 index, int32 block) const {
+	if (!_blockCache)
+		return false;
+
+	for (int i = 0; i < kNumCachedBundleBlocks; i++) {
+		const DecompressedBlock &entry = _blockCache[i];
+		if (entry.slot == slot && entry.index == index && entry.block == block)
+			return true;
+	}
+
+	return false;
+}
+
+bool BundleDirCache::getCachedBlock(int slot, int32 index, int32 block, byte *dst, int32 &size) {
+	if (!_blockCache)
+		return false;
+
+	for (int i = 0; i < kNumCachedBundleBlocks; i++) {
+		DecompressedBlock &entry = _blockCache[i];
+		if (entry.slot == slot && entry.index == index && entry.block == block) {
+			entry.lastUsed = ++_blockCacheStamp;
+			memcpy(dst, entry.data, entry.size);
+			size = entry.size;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void BundleDirCache::storeCachedBlock(int slot, int32 index, int32 block, const byte *src, int32 size) {
+	if (size <= 0 || size > DIMUSE_BUN_CHUNK_SIZE)
+		return;
+
+	if (!_blockCache) {
+		_blockCache = (DecompressedBlock *)malloc(kNumCachedBundleBlocks * sizeof(DecompressedBlock));
+		if (!_blockCache)
+			return;
+		for (int i = 0; i < kNumCachedBundleBlocks; i++) {
+			_blockCache[i].slot = -1;
+			_blockCache[i].lastUsed = 0;
+		}
+	}
+
+	// Take a free entry if there is one, otherwise evict the least recently used
+	DecompressedBlock *victim = &_blockCache[0];
+	for (int i = 0; i < kNumCachedBundleBlocks; i++) {
+		if (_blockCache[i].slot == -1) {
+			victim = &_blockCache[i];
+			break;
+		}
+		if (_blockCache[i].lastUsed < victim->lastUsed)
+			victim = &_blockCache[i];
+	}
+
+	victim->slot = slot;
+	victim->index = index;
+	victim->block = block;
+	victim->size = size;
+	victim->lastUsed = ++_blockCacheStamp;
+	memcpy(victim->data, src, size);
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -185,6 +257,7 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_bundleSlot = slot;
 	isCompressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -214,6 +287,7 @@ void BundleMgr::close() {
 		_lastBlock = -1;
 		_outputSize = 0;
 		_curSampleId = -1;
+		_bundleSlot = -1;
 		free(_compTable);
 		_compTable = nullptr;
 		free(_compInputBuff);
@@ -257,6 +331,19 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+int32 BundleMgr::decompressBlock(int32 index, int32 block, byte *dst) {
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[index].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	int32 outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, dst, _compTable[block].size);
+
+	if (outputSize > DIMUSE_BUN_CHUNK_SIZE) {
+		error("_outputSize: %d", outputSize);
+	}
+	return outputSize;
+}
+
 int32 BundleMgr::seekFile(int32 offset, int mode) {
 	// We don't actually seek the file, but instead try to find that the specified offset exists
 	// within the decompressed blocks, and save that offset in _curDecompressedFilePos
@@ -350,14 +437,12 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 		for (i = firstBlock; i <= lastBlock; i++) {
 			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
+				int32 cachedSize;
+				if (_cache->getCachedBlock(_bundleSlot, found->index, i, _compOutputBuff, cachedSize)) {
+					_outputSize = cachedSize;
+				} else {
+					_outputSize = decompressBlock(found->index, i, _compOutputBuff);
+					_cache->storeCachedBlock(_bundleSlot, found->index, i, _compOutputBuff, _outputSize);
 				}
 				_lastBlock = i;
 			}
@@ -398,6 +483,28 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 	return final_size;
 }
 
+// Decompresses the blocks following the current read position into the block
+// cache, but no more than maxDecompressed of them. Returns the number of blocks
+// which were decompressed.
+int BundleMgr::readAhead(int maxDecompressed) {
+	if (!_file->isOpen() || !_compTableLoaded || _isUncompressed || _curSampleId == -1)
+		return 0;
+
+	byte outputBuff[DIMUSE_BUN_CHUNK_SIZE];
+	const int firstBlock = _curDecompressedFilePos / DIMUSE_BUN_CHUNK_SIZE;
+	int decompressed = 0;
+	for (int i = firstBlock; i < firstBlock + kNumReadAheadBundleBlocks && i < _numCompItems && decompressed < maxDecompressed; i++) {
+		if (i == _lastBlock || _cache->hasCachedBlock(_bundleSlot, _curSampleId, i))
+			continue;
+
+		const int32 outputSize = decompressBlock(_curSampleId, i, outputBuff);
+		_cache->storeCachedBlock(_bundleSlot, _curSampleId, i, outputBuff, outputSize);
+		decompressed++;
+	}
+
+	return decompressed;
+}
+
 bool BundleMgr::isExtCompBun(byte gameId) {
 	bool isExtComp = false;
 	if (gameId == GID_CMI) {
@@ -53,6 +53,20 @@ private:
 		IndexNode *indexTable;
 	} _bundleDirCache[4];
 
+	// Decompressed bundle blocks, shared by all BundleMgr instances so that
+	// looping music and replayed voice lines don't hit the codecs again.
+	struct DecompressedBlock {
+		int slot;
+		int32 index;
+		int32 block;
+		int32 size;
+		uint32 lastUsed;
+		byte data[DIMUSE_BUN_CHUNK_SIZE];
+	};
+
+	DecompressedBlock *_blockCache;
+	uint32 _blockCacheStamp;
+
 	const ScummEngine *_vm;
 public:
 	BundleDirCache(const ScummEngine *vm);
@@ -63,6 +77,10 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	bool hasCachedBlock(int slot, int32 index, int32 block) const;
+	bool getCachedBlock(int slot, int32 index, int32 block, byte *dst, int32 &size);
+	void storeCachedBlock(int slot, int32 index, int32 block, const byte *src, int32 size);
 };
 
 class BundleMgr {
@@ -88,11 +106,13 @@ private:
 	bool _compTableLoaded = 0;
 	bool _isUncompressed = 0;
 	int _fileBundleId = 0;
+	int _bundleSlot = -1;
 	byte _compOutputBuff[0x2000] = {};
 	byte *_compInputBuff = nullptr;
 	int _outputSize = 0;
 	int _lastBlock = 0;
 	bool loadCompTable(int32 index);
+	int32 decompressBlock(int32 index, int32 block, byte *dst);
 
 public:
 
@@ -104,6 +124,7 @@ public:
 	Common::SeekableReadStream *getFile(const char *filename, int32 &offset, int32 &size);
 	int32 seekFile(int32 offset, int size);
 	int32 readFile(const char *name, int32 size, byte **compFinal, bool headerOutside);
+	int readAhead(int maxDecompressed);
 	bool isExtCompBun(byte gameId);
 };
 
@@ -36,6 +36,9 @@
 
 namespace Scumm {
 
+// Bundle blocks decompressed ahead of the streams per engine frame
+static const int kMaxReadAheadBundleBlocks = 2;
+
 void IMuseDigital::timer_handler(void *refCon) {
 	IMuseDigital *diMUSE = (IMuseDigital *)refCon;
 	diMUSE->callback();
@@ -537,6 +540,16 @@ void IMuseDigital::flushTracks() {
 	_filesHandler->flushSounds();
 }
 
+// Decompress the upcoming bundle blocks of the open sounds on the engine
+// thread, so that the audio callback finds them in the block cache
+void IMuseDigital::readAheadStreams() {
+	if (_isEngineDisabled || isFTSoundEngine())
+		return;
+
+	Common::StackLock lock(*_mutex);
+	_filesHandler->readAheadSounds(kMaxReadAheadBundleBlocks);
+}
+
 // This is used in order to avoid crash everything
 // if a compressed audio resource file is found
 void IMuseDigital::disableEngine() {
@@ -347,6 +347,7 @@ public:
 	void parseScriptCmds(int cmd, int soundId, int sub_cmd, int d, int e, int f, int g, int h, int i, int j, int k, int l, int m, int n, int o, int p);
 	void refreshScripts();
 	void flushTracks();
+	void readAheadStreams();
 	void disableEngine();
 	bool isEngineDisabled();
 	void stopSMUSHAudio();
@@ -414,6 +414,15 @@ void IMuseDigiFilesHandler::flushSounds() {
 	}
 }
 
+void IMuseDigiFilesHandler::readAheadSounds(int maxDecompressed) {
+	ImuseDigiSndMgr::SoundDesc *s = _sound->getSounds();
+	for (int i = 0; i < MAX_IMUSE_SOUNDS && maxDecompressed > 0; i++) {
+		ImuseDigiSndMgr::SoundDesc *curSnd = &s[i];
+		if (curSnd->inUse && !curSnd->scheduledForDealloc && curSnd->bundle)
+			maxDecompressed -= curSnd->bundle->readAhead(maxDecompressed);
+	}
+}
+
 int IMuseDigiFilesHandler::setCurrentSpeechFilename(const char *fileName) {
 	Common::strlcpy(_currentSpeechFilename, fileName, sizeof(_currentSpeechFilename));
 	if (openSound(kTalkSoundID))
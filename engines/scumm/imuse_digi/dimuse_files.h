@@ -64,6 +64,7 @@ public:
 	void allocSoundBuffer(int bufId, int32 size, int32 loadSize, int32 criticalSize);
 	void deallocSoundBuffer(int bufId);
 	void flushSounds();
+	void readAheadSounds(int maxDecompressed);
 	int setCurrentSpeechFilename(const char *fileName);
 	void setCurrentFtSpeechFile(const char *fileName, ScummFile *file, uint32 offset, uint32 size);
 	void closeSoundImmediatelyById(int soundId);
@@ -735,6 +735,71 @@ int ScummEngine::loadResource(ResType type, ResId idx) {
 	return 1;
 }
 
+/**
+ * Queue the scripts, costumes and sounds stored in the data block of the
+ * current room for loading. Resources are grouped by the room which uses
+ * them, so these are the ones most likely to be needed next, and reading
+ * them while the room file is already open avoids stalls on their first use.
+ */
+void ScummEngine::queueRoomResourcePrefetch() {
+	_prefetchQueue.clear();
+
+	// HE games use a different resource layout, and v4 and older games are
+	// small enough to not benefit from this.
+	if (_roomResource == 0 || _game.version < 5 || _game.heversion != 0 ||
+		(_game.features & (GF_SMALL_HEADER | GF_OLD_BUNDLE)))
+		return;
+
+	static const ResType prefetchTypes[] = { rtScript, rtCostume, rtSound };
+
+	for (int i = 0; i < ARRAYSIZE(prefetchTypes); i++) {
+		const ResType type = prefetchTypes[i];
+		for (ResId idx = 1; idx < _res->_types[type].size(); idx++) {
+			const ResourceManager::Resource &res = _res->_types[type][idx];
+			if (!res._address && res._roomno == _roomResource && res._roomoffs != RES_INVALID_OFFSET) {
+				PrefetchRequest req;
+				req.type = type;
+				req.idx = idx;
+				_prefetchQueue.push(req);
+			}
+		}
+	}
+}
+
+/**
+ * Load queued resources until the given time budget (in ms) is used up.
+ * Resources which would cause other resources to expire are skipped.
+ * Prefetched resources are the first to expire until they are actually used.
+ *
+ * Loading is done on the engine thread: the data files and the resource
+ * manager are not safe to use from a separate thread.
+ */
+void ScummEngine::prefetchResources(uint32 timeBudget) {
+	const uint32 startTime = _system->getMillis();
+
+	while (!_prefetchQueue.empty()) {
+		if (_system->getMillis() - startTime >= timeBudget)
+			break;
+
+		const PrefetchRequest req = _prefetchQueue.pop();
+		if (_res->isResourceLoaded(req.type, req.idx) || getResourceRoomNr(req.type, req.idx) != _roomResource)
+			continue;
+
+		// The resource is in the data block of the current room, which is
+		// still open, so the size is just a block header away
+		openRoom(_roomResource);
+		_fileHandle->seek(getResourceRoomOffset(req.type, req.idx) + _fileOffset + 4, SEEK_SET);
+		const uint32 size = _fileHandle->readUint32BE();
+		if (!_res->hasHeapSpaceFor(size))
+			continue;
+
+		debugC(DEBUG_RESOURCE, "prefetchResources(%s,%d)", nameOfResType(req.type), req.idx);
+		ensureResourceLoaded(req.type, req.idx);
+		if (_res->isResourceLoaded(req.type, req.idx))
+			_res->setResourceUnused(req.type, req.idx);
+	}
+}
+
 int ScummEngine::getResourceRoomNr(ResType type, ResId idx) {
 	if (type == rtRoom && _game.heversion < 70)
 		return idx;
@@ -783,7 +848,7 @@ byte *ScummEngine::getResourceAddress(ResType type, ResId idx) {
 		return nullptr;
 	}
 
-	_res->setResourceCounter(type, idx, 1);
+	_res->touchResource(type, idx);
 
 	debugC(DEBUG_RESOURCE, "getResourceAddress(%s,%d) == %p", nameOfResType(type), idx, (void *)ptr);
 	return ptr;
@@ -829,6 +894,18 @@ void ResourceManager::setResourceCounter(ResType type, ResId idx, byte counter)
 	_types[type][idx].setResourceCounter(counter);
 }
 
+void ResourceManager::touchResource(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	res.setResourceCounter(1);
+	res._lastUsed = ++_useStamp;
+}
+
+void ResourceManager::setResourceUnused(ResType type, ResId idx) {
+	Resource &res = _types[type][idx];
+	res.setResourceCounter(RF_USAGE_MAX);
+	res._lastUsed = 0;
+}
+
 void ResourceManager::Resource::setResourceCounter(byte counter) {
 	_flags &= RF_LOCK;	// Clear lower 7 bits, preserve the lock bit.
 	_flags |= counter;	// Update the usage counter
@@ -873,7 +950,7 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
-	setResourceCounter(type, idx, 1);
+	touchResource(type, idx);
 
 	_vm->_insideCreateResource--;
 
@@ -887,6 +964,7 @@ ResourceManager::Resource::Resource() {
 	_status = 0;
 	_roomno = 0;
 	_roomoffs = 0;
+	_lastUsed = 0;
 }
 
 ResourceManager::Resource::~Resource() {
@@ -915,6 +993,7 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_useStamp = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -1083,6 +1162,7 @@ void ResourceManager::Resource::setOnHeap() {
 
 void ResourceManager::expireResources(uint32 size) {
 	byte best_counter;
+	uint32 best_stamp;
 	ResType best_type;
 	int best_res = 0;
 	uint32 oldAllocatedSize;
@@ -1100,6 +1180,7 @@ void ResourceManager::expireResources(uint32 size) {
 	do {
 		best_type = rtInvalid;
 		best_counter = 2;
+		best_stamp = 0;
 
 		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 			if (_types[type]._mode != kDynamicResTypeMode) {
@@ -1109,8 +1190,15 @@ void ResourceManager::expireResources(uint32 size) {
 				while (idx-- > 0) {
 					Resource &tmp = _types[type][idx];
 					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !tmp.isOffHeap()) {
+						// The usage counters saturate quickly, so among resources
+						// with the same counter expire the least recently used one.
+						if (counter == best_counter && best_type != rtInvalid && tmp._lastUsed >= best_stamp)
+							continue;
+						if (_vm->isResourceInUse(type, idx))
+							continue;
 						best_counter = counter;
+						best_stamp = tmp._lastUsed;
 						best_type = type;
 						best_res = idx;
 					}
@@ -125,6 +125,13 @@ public:
 		 */
 		uint32 _roomoffs;
 
+		/**
+		 * Value of the resource manager's use stamp when this resource was
+		 * last accessed. Used to evict the least recently used resource out
+		 * of all resources with the same (saturated) usage counter.
+		 */
+		uint32 _lastUsed;
+
 	public:
 		Resource();
 		~Resource();
@@ -174,6 +181,7 @@ protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
+	uint32 _useStamp;
 
 public:
 	ResourceManager(ScummEngine *vm);
@@ -182,6 +190,12 @@ public:
 	void setHeapThreshold(int min, int max);
 	uint32 getHeapSize() { return _allocatedSize; }
 
+	/**
+	 * Returns true if a resource of the given size can be allocated without
+	 * causing other resources to be expired.
+	 */
+	bool hasHeapSpaceFor(uint32 size) const { return size + _allocatedSize < _maxHeapThreshold; }
+
 	void allocResTypeData(ResType type, uint32 tag, int num, ResTypeMode mode);
 	void freeResources();
 
@@ -216,6 +230,18 @@ public:
 	 */
 	void setResourceCounter(ResType type, ResId idx, byte counter);
 
+	/**
+	 * Mark the specified resource as just used: reset its counter and
+	 * record the access for the least recently used ordering.
+	 */
+	void touchResource(ResType type, ResId idx);
+
+	/**
+	 * Mark the specified resource as not used yet, so that it is expired
+	 * before any resource which was, until it is touched.
+	 */
+	void setResourceUnused(ResType type, ResId idx);
+
 	/**
 	 * Increment the counter of all unlocked loaded resources.
 	 * The maximal count is 255.
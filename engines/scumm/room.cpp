@@ -165,6 +165,8 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 	if (room != 0)
 		ensureResourceLoaded(rtRoom, room);
 
+	queueRoomResourcePrefetch();
+
 	clearRoomObjects();
 
 	if (_currentRoom == 0) {
@@ -745,6 +745,9 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 
 	closeRoom();
 
+	// Queued prefetches refer to the room that was current before loading
+	_prefetchQueue.clear();
+
 	memset(_inventory, 0, sizeof(_inventory[0]) * _numInventory);
 	memset(_newNames, 0, sizeof(_newNames[0]) * _numNewNames);
 
@@ -476,22 +476,42 @@ void ScummEngine::resetScriptPointer() {
 }
 
 /**
- * This method checks whether the resource that contains the active script
- * moved, and if so, updates the script pointer accordingly.
+ * This method is called when the resource that contains the active script
+ * moved, and updates the script pointer accordingly.
  *
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::relocateScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
+	// The debug hooks can only be toggled from the debugger console, which
+	// never runs while a script is being executed, so check them once up
+	// front and keep the common case loop free of them.
+	if (_showStack || _hexdumpScripts || debugChannelSet(-1, DEBUG_OPCODES)) {
+		executeScriptTraced();
+		return;
+	}
+
+	// V0-V2 games didn't use the didexec flag
+	const bool setDidExec = (_game.version > 2);
+
+	while (_currentScript != 0xFF) {
+		_opcode = fetchScriptByte();
+		if (setDidExec)
+			vm.slot[_currentScript].didexec = true;
+
+		executeOpcode(_opcode);
+	}
+}
+
+/** Same as executeScript(), but with the opcode tracing debug hooks */
+void ScummEngine::executeScriptTraced() {
 	int c;
 	while (_currentScript != 0xFF) {
 
@@ -522,12 +542,8 @@ void ScummEngine::executeScript() {
 	}
 }
 
-void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
-	else {
-		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
-	}
+void ScummEngine::invalidOpcode(byte i) {
+	error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 }
 
 const char *ScummEngine::getOpcodeDesc(byte i) {
@@ -538,11 +554,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
@@ -22,32 +22,35 @@
 #ifndef SCUMM_SCRIPT_H
 #define SCUMM_SCRIPT_H
 
-#include "common/func.h"
+#include "common/noncopyable.h"
 
 namespace Scumm {
 
-typedef Common::Functor0<void> Opcode;
+class ScummEngine;
+
+/**
+ * Opcode handlers are plain member function pointers, so the interpreter
+ * loop can call them directly instead of going through a heap allocated
+ * functor and a virtual call for every executed opcode. Handlers of the
+ * version specific subclasses are stored by casting them to the base
+ * class; they are only ever invoked on the engine that registered them.
+ */
+typedef void (ScummEngine::*OpcodeProc)();
 
 struct OpcodeEntry : Common::NonCopyable {
-	Opcode *proc;
+	OpcodeProc proc;
 #ifndef REDUCE_MEMORY_USAGE
 	const char *desc;
 #endif
 
 #ifndef REDUCE_MEMORY_USAGE
-	OpcodeEntry() : proc(0), desc(0) {}
+	OpcodeEntry() : proc(nullptr), desc(nullptr) {}
 #else
-	OpcodeEntry() : proc(0) {}
+	OpcodeEntry() : proc(nullptr) {}
 #endif
-	~OpcodeEntry() {
-		setProc(0, 0);
-	}
 
-	void setProc(Opcode *p, const char *d) {
-		if (proc != p) {
-			delete proc;
-			proc = p;
-		}
+	void setProc(OpcodeProc p, const char *d) {
+		proc = p;
 #ifndef REDUCE_MEMORY_USAGE
 		desc = d;
 #endif
@@ -58,9 +61,9 @@ struct OpcodeEntry : Common::NonCopyable {
 // This is to help devices with small memory (PDA, smartphones, ...)
 // to save abit of memory used by opcode names in the Scumm engine.
 #ifndef REDUCE_MEMORY_USAGE
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), #x)
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), #x)
 #else
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), "")
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), "")
 #endif
 
 /**
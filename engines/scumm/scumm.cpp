@@ -124,6 +124,23 @@ struct dbgChannelDesc {
 
 const char *const insaneKeymapId = "scumm-insane";
 
+// Memory used to keep decoded room backgrounds around, see Gdi::findRoomBgCacheEntry()
+#ifdef REDUCE_MEMORY_USAGE
+static const uint32 kRoomBgCacheBudget = 512 * 1024;
+#else
+static const uint32 kRoomBgCacheBudget = 4 * 1024 * 1024;
+#endif
+
+// Memory used to keep decoded AKOS cels around, see AkosRenderer::getDecodedCel()
+#ifdef REDUCE_MEMORY_USAGE
+static const uint32 kDecodedCelBudget = 256 * 1024;
+#else
+static const uint32 kDecodedCelBudget = 2 * 1024 * 1024;
+#endif
+
+// Time (in ms) per frame which may be spent loading resources ahead of use
+static const uint32 kPrefetchTimeBudget = 4;
+
 ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	: Engine(syst),
 	  _game(dr.game),
@@ -150,6 +167,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 		_gdi = new GdiV2(this);
 	} else {
 		_gdi = new Gdi(this);
+		_gdi->setRoomBgCacheBudget(kRoomBgCacheBudget);
 	}
 	_res = new ResourceManager(this);
 
@@ -1701,6 +1719,16 @@ void ScummEngine::setupScumm(const Common::Path &macResourceFile) {
 	_res->setHeapThreshold(16 * 1024 * 1024, 32 * 1024 * 1024);
 #endif
 
+	// Allow the resource heap size (in KB) to be tuned for the device, e.g.
+	// to keep more resources around on systems with slow storage.
+	if (ConfMan.hasKey("scumm_heap_size")) {
+		const int heapSize = ConfMan.getInt("scumm_heap_size");
+		if (heapSize > 0) {
+			const int maxHeap = (int)MIN<int64>((int64)heapSize * 1024, INT_MAX);
+			_res->setHeapThreshold(maxHeap / 4 * 3, maxHeap);
+		}
+	}
+
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
 }
@@ -1824,7 +1852,9 @@ void ScummEngine::setupCharsetRenderer(const Common::Path &macFontFile) {
 
 void ScummEngine::setupCostumeRenderer() {
 	if (_game.features & GF_NEW_COSTUMES) {
-		_costumeRenderer = new AkosRenderer(this);
+		AkosRenderer *akosRenderer = new AkosRenderer(this);
+		akosRenderer->setDecodedCelBudget(kDecodedCelBudget);
+		_costumeRenderer = akosRenderer;
 		_costumeLoader = new AkosCostumeLoader(this);
 	} else if (_game.version == 0) {
 		_costumeRenderer = new V0CostumeRenderer(this);
@@ -3048,6 +3078,8 @@ load_game:
 
 	_res->increaseExpireCounter();
 
+	prefetchResources(kPrefetchTimeBudget);
+
 	if (!isUsingOriginalGUI() || ((_game.version >= 3) || !isPaused()))
 		animateCursor();
 
@@ -3878,6 +3910,7 @@ void ScummEngine_v7::scummLoop_handleSound() {
 	if (_imuseDigital) {
 		_imuseDigital->flushTracks();
 		_imuseDigital->refreshScripts();
+		_imuseDigital->readAheadStreams();
 	}
 
 	_splayer->setChanFlag(0, VAR(VAR_VOICE_MODE) != 0);
@@ -3947,6 +3980,7 @@ void ScummEngine::restart() {
 	_currentRoom = 0;
 	_currentScript = 0xFF;
 	killAllScriptsExceptCurrent();
+	_prefetchQueue.clear();
 
 #ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
 	if (_townsScreen && _game.id == GID_MONKEY) {
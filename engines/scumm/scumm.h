@@ -30,6 +30,7 @@
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/mutex.h"
+#include "common/queue.h"
 #include "common/random.h"
 #include "common/rect.h"
 #include "common/rendermode.h"
@@ -977,7 +978,14 @@ protected:
 	OpcodeEntry _opcodes[256];
 
 	virtual void setupOpcodes() = 0;
-	void executeOpcode(byte i);
+	void executeOpcode(byte i) {
+		OpcodeProc proc = _opcodes[i].proc;
+		if (proc)
+			(this->*proc)();
+		else
+			invalidOpcode(i);
+	}
+	void invalidOpcode(byte i);
 	const char *getOpcodeDesc(byte i);
 
 	void initializeLocals(int slot, int *vars);
@@ -995,6 +1003,7 @@ protected:
 	void runObjectScript(int script, int entry, bool freezeResistant, bool recursive, int *vars, int slot = -1, int cycle = 0);
 	void runScriptNested(int script);
 	void executeScript();
+	void executeScriptTraced();
 	void updateScriptPtr();
 	virtual void runInventoryScript(int i);
 	virtual void runInventoryScriptEx(int i);
@@ -1021,8 +1030,19 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	/**
+	 * Checks whether the resource that contains the active script moved,
+	 * and if so, updates the script pointer accordingly.
+	 */
+	void refreshScriptPointer() {
+		if (*_lastCodePtr != _scriptOrgPointer)
+			relocateScriptPointer();
+	}
+	void relocateScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
 	uint fetchScriptDWord();
@@ -1097,6 +1117,20 @@ protected:
 	int readSoundResourceSmallHeader(ResId idx);
 	bool isResourceInUse(ResType type, ResId idx) const;
 
+	struct PrefetchRequest {
+		ResType type;
+		ResId idx;
+	};
+
+	/**
+	 * Resources stored in the data block of the current room, which are
+	 * loaded ahead of their first use while the engine is otherwise idle.
+	 */
+	Common::Queue<PrefetchRequest> _prefetchQueue;
+
+	void queueRoomResourcePrefetch();
+	void prefetchResources(uint32 timeBudget);
+
 	virtual void setupRoomSubBlocks();
 	virtual void resetRoomSubBlocks();
 
@@ -1427,6 +1461,7 @@ protected:
 
 	Common::KeyState mac_showOldStyleBannerAndPause(const char *msg, int32 waitTime);
 
+	bool isTextSurfaceAreaTransparent(const uint32 *text32, int width, int height) const;
 	const byte *postProcessDOSGraphics(VirtScreen *vs, int &pitch, int &x, int &y, int &width, int &height) const;
 	const byte *ditherVGAtoEGA(int &pitch, int &x, int &y, int &width, int &height) const;
 
@@ -44,17 +44,6 @@ namespace Scumm {
 		(dst)[1] = (src)[1];    \
 	} while (0)
 
-
-#else /* SCUMM_NEED_ALIGNMENT */
-
-#define COPY_4X1_LINE(dst, src)               \
-	*(uint32 *)(dst) = *(const uint32 *)(src)
-
-#define COPY_2X1_LINE(dst, src)               \
-	*(uint16 *)(dst) = *(const uint16 *)(src)
-
-#endif
-
 #define FILL_4X1_LINE(dst, val) \
 	do {                        \
 		(dst)[0] = val;         \
@@ -69,6 +58,31 @@ namespace Scumm {
 		(dst)[1] = val;         \
 	} while (0)
 
+#define DECLARE_FILL_TEMP(v, val) \
+	byte v = val
+
+#else /* SCUMM_NEED_ALIGNMENT */
+
+#define COPY_4X1_LINE(dst, src)               \
+	*(uint32 *)(dst) = *(const uint32 *)(src)
+
+#define COPY_2X1_LINE(dst, src)               \
+	*(uint16 *)(dst) = *(const uint16 *)(src)
+
+// The fill value is replicated into every byte of a machine word once
+// per block, so each line of a solid block is a single store.
+
+#define FILL_4X1_LINE(dst, val)               \
+	*(uint32 *)(dst) = val
+
+#define FILL_2X1_LINE(dst, val)               \
+	*(uint16 *)(dst) = (uint16)(val)
+
+#define DECLARE_FILL_TEMP(v, val) \
+	uint32 v = (val) * 0x01010101U
+
+#endif
+
 #define MOTION_OFFSET_TABLE_SIZE 0xF8
 #define PROCESS_SUBBLOCKS        0xFF
 #define FILL_SINGLE_COLOR        0xFE
@@ -385,7 +399,7 @@ void SmushDeltaGlyphsDecoder::level3(byte *dDst) {
 		COPY_2X1_LINE(dDst + _dPitch, _dSrc + 2);
 		_dSrc += 4;
 	} else if (code == FILL_SINGLE_COLOR) {
-		byte t = *_dSrc++;
+		DECLARE_FILL_TEMP(t, *_dSrc++);
 		FILL_2X1_LINE(dDst, t);
 		FILL_2X1_LINE(dDst + _dPitch, t);
 	} else if (code == COPY_PREV_BUFFER) {
@@ -393,7 +407,7 @@ void SmushDeltaGlyphsDecoder::level3(byte *dDst) {
 		COPY_2X1_LINE(dDst, dDst + tmp);
 		COPY_2X1_LINE(dDst + _dPitch, dDst + _dPitch + tmp);
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t, _paramPtr[code]);
 		FILL_2X1_LINE(dDst, t);
 		FILL_2X1_LINE(dDst + _dPitch, t);
 	}
@@ -419,7 +433,7 @@ void SmushDeltaGlyphsDecoder::level2(byte *d_dst) {
 		d_dst += 2;
 		level3(d_dst);
 	} else if (code == FILL_SINGLE_COLOR) {
-		byte t = *_dSrc++;
+		DECLARE_FILL_TEMP(t, *_dSrc++);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _dPitch;
@@ -447,7 +461,7 @@ void SmushDeltaGlyphsDecoder::level2(byte *d_dst) {
 			d_dst += _dPitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t, _paramPtr[code]);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _dPitch;
@@ -476,7 +490,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 		d_dst += 4;
 		level2(d_dst);
 	} else if (code == FILL_SINGLE_COLOR) {
-		byte t = *_dSrc++;
+		DECLARE_FILL_TEMP(t, *_dSrc++);
 		for (i = 0; i < 8; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			FILL_4X1_LINE(d_dst + 4, t);
@@ -507,7 +521,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 			d_dst += _dPitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		DECLARE_FILL_TEMP(t, _paramPtr[code]);
 		for (i = 0; i < 8; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			FILL_4X1_LINE(d_dst + 4, t);
@@ -234,6 +234,10 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_base = nullptr;
 	_frameBuffer = nullptr;
 	_specialBuffer = nullptr;
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
+	_inflateBuffer = nullptr;
+	_inflateBufferSize = 0;
 
 	_seekPos = -1;
 
@@ -329,6 +333,14 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = nullptr;
 
+	free(_chunkBuffer);
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
+
+	free(_inflateBuffer);
+	_inflateBuffer = nullptr;
+	_inflateBufferSize = 0;
+
 	_IACTstream = nullptr;
 
 	_vm->_smushActive = false;
@@ -809,6 +821,17 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 	}
 }
 
+byte *SmushPlayer::ensureScratchBuffer(byte *&buffer, uint32 &bufferSize, uint32 size) {
+	if (size > bufferSize) {
+		free(buffer);
+		buffer = (byte *)malloc(size);
+		if (!buffer)
+			error("SmushPlayer::ensureScratchBuffer(): Unable to allocate %d bytes", size);
+		bufferSize = size;
+	}
+	return buffer;
+}
+
 void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b) {
 	if (_skipNext) {
 		_skipNext = false;
@@ -816,15 +839,13 @@ void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStrea
 	}
 
 	int32 chunkSize = subSize;
-	byte *chunkBuffer = (byte *)malloc(chunkSize);
-	assert(chunkBuffer);
+	byte *chunkBuffer = ensureScratchBuffer(_chunkBuffer, _chunkBufferSize, chunkSize);
 	b.read(chunkBuffer, chunkSize);
 
 	unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
-	byte *fobjBuffer = (byte *)malloc(decompressedSize);
+	byte *fobjBuffer = ensureScratchBuffer(_inflateBuffer, _inflateBufferSize, decompressedSize);
 	if (!Common::inflateZlib(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
 		error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
-	free(chunkBuffer);
 
 	byte *ptr = fobjBuffer;
 	int codec = READ_LE_UINT16(ptr); ptr += 2;
@@ -834,8 +855,6 @@ void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStrea
 	int height = READ_LE_UINT16(ptr); ptr += 2;
 
 	decodeFrameObject(codec, fobjBuffer + 14, left, top, width, height);
-
-	free(fobjBuffer);
 }
 
 void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b) {
@@ -855,13 +874,10 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
+	byte *chunk_buffer = ensureScratchBuffer(_chunkBuffer, _chunkBufferSize, chunk_size);
 	b.read(chunk_buffer, chunk_size);
 
 	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
-
-	free(chunk_buffer);
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
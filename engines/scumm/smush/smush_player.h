@@ -141,6 +141,13 @@ private:
 	byte *_frameBuffer;
 	byte *_specialBuffer;
 
+	// Scratch buffers for FOBJ/ZFOB payloads; kept across frames so that
+	// streaming a cutscene does not hit the allocator twice per frame.
+	byte *_chunkBuffer;
+	uint32 _chunkBufferSize;
+	byte *_inflateBuffer;
+	uint32 _inflateBufferSize;
+
 	Common::String _seekFile;
 	uint32 _startFrame;
 	uint32 _startTime;
@@ -236,6 +243,7 @@ private:
 
 	bool readString(const char *file);
 	void decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height);
+	byte *ensureScratchBuffer(byte *&buffer, uint32 &bufferSize, uint32 size);
 	void handleAnimHeader(int32 subSize, Common::SeekableReadStream &);
 	void handleFrame(int32 frameSize, Common::SeekableReadStream &);
 	void handleNewPalette(int32 subSize, Common::SeekableReadStream &);